@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef APP_CONFIGURATION_HPP
+#define APP_CONFIGURATION_HPP
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>Audio Streaming Configuration
+// ===================================
+
+//  <o>Capture Block Length [ms] <10-500>
+//  <i> Define the length of the audio blocks delivered by the audio driver.
+//  <i> Shorter blocks make new audio available to the inference sooner.
+//  <i> Default: 500
+#ifndef AUDIO_BLOCK_MS
+#define AUDIO_BLOCK_MS              500
+#endif
+
+//  <o>Inference Hop [ms] <20-1000:20>
+//  <i> Define the time between the starts of two consecutive inference windows,
+//  <i> a multiple of the 20 ms MFCC frame stride. The keyword end precedes the
+//  <i> end of the window it is detected in by up to one hop.
+//  <i> Low latency streaming: 20 ms blocks and 100-250 ms hop.
+//  <i> Default: 500
+#ifndef KWS_INFERENCE_HOP_MS
+#define KWS_INFERENCE_HOP_MS        500
+#endif
+
+// </h>
+
+// <h>Voice Activity Gate Configuration
+// ===================================
+
+//  <q>Voice Activity Gate
+//  <i> Enable to skip feature extraction and inference on silent windows of
+//  <i> the live audio stream. The capture thread classifies 10 ms frames by
+//  <i> their energy before the gain and their zero crossing rate, a window is
+//  <i> inferred when it overlaps a speech frame or its hangover.
+//  <i> Default: 0
+#ifndef VAD_GATE
+#define VAD_GATE                    0
+#endif
+
+//  <o>Energy Threshold [dBFS] <-90-0>
+//  <i> Define the RMS level of a frame, relative to the full scale, above
+//  <i> which the frame may be speech.
+//  <i> Default: -50
+#ifndef VAD_ENERGY_THRESHOLD_DB
+#define VAD_ENERGY_THRESHOLD_DB     -50
+#endif
+
+//  <o>Maximum Zero Crossing Rate [%] <1-100>
+//  <i> Define the zero crossings per frame sample, in percent, above which a
+//  <i> frame is considered noise (broadband hiss) rather than speech.
+//  <i> Default: 50
+#ifndef VAD_ZCR_MAX
+#define VAD_ZCR_MAX                 50
+#endif
+
+//  <o>Hangover [ms] <0-2000>
+//  <i> Define how long audio after the last speech frame is still treated as
+//  <i> speech, so that quiet keyword endings are not cut off.
+//  <i> Default: 300
+#ifndef VAD_HANGOVER_MS
+#define VAD_HANGOVER_MS             300
+#endif
+
+// </h>
+
+// <h>Heap Monitor Configuration
+// ===================================
+
+//  <q>Heap Monitor
+//  <i> Count heap allocations made after the application initialisation is
+//  <i> complete and report them from the keyword spotting loop, which is
+//  <i> expected to run without allocating.
+//  <i> Default: 0
+#ifndef APP_HEAP_MONITOR
+#define APP_HEAP_MONITOR            0
+#endif
+
+//  <q>Break on Allocation
+//  <i> Execute a breakpoint instruction on the first counted allocation, so the
+//  <i> debugger shows its call stack. Without a debugger the application stops.
+//  <i> Default: 0
+#ifndef APP_HEAP_MONITOR_BREAK
+#define APP_HEAP_MONITOR_BREAK      0
+#endif
+
+// </h>
+
+#endif /* APP_CONFIGURATION_HPP */
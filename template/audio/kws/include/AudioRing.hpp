@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_RING_HPP
+#define AUDIO_RING_HPP
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief   Read-only view of consecutive audio samples, which may wrap
+ *          around the end of a ring buffer.
+ */
+class AudioView {
+public:
+    /**
+     * @brief   Constructor of an empty view.
+     */
+    AudioView();
+
+    /**
+     * @brief       Constructor.
+     * @param[in]   buffer      Sample storage.
+     * @param[in]   capacity    Number of samples in the storage.
+     * @param[in]   start       Storage index of the first sample of the view.
+     * @param[in]   size        Number of samples in the view.
+     * @param[in]   position    Stream position of the first sample of the view.
+     */
+    AudioView(const int16_t* buffer, uint32_t capacity, uint32_t start,
+              uint32_t size, uint32_t position);
+
+    /**
+     * @brief   Gets the number of samples in the view.
+     * @return  Number of samples.
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * @brief   Gets the stream position of the first sample of the view.
+     * @return  Stream position in samples.
+     */
+    uint32_t GetPosition() const;
+
+    /**
+     * @brief       Gets a part of the view, without copying the samples.
+     * @param[in]   offset  Offset of the part in the view.
+     * @param[in]   size    Number of samples in the part.
+     * @return      View of the part, empty if it exceeds the view.
+     */
+    AudioView GetWindow(uint32_t offset, uint32_t size) const;
+
+    /**
+     * @brief       Copies samples of the view to a linear buffer.
+     * @param[in]   offset  Offset of the first sample in the view.
+     * @param[in]   count   Number of samples, offset + count must not exceed the view.
+     * @param[out]  dst     Destination buffer.
+     */
+    void Copy(uint32_t offset, uint32_t count, int16_t* dst) const;
+
+private:
+    const int16_t* m_buffer;
+    uint32_t       m_capacity;
+    uint32_t       m_start;
+    uint32_t       m_size;
+    uint32_t       m_position;
+};
+
+/**
+ * @brief   Lock-free single producer, single consumer ring of audio samples.
+ *
+ * The capture thread writes at the head and the application thread reads
+ * from the tail, each index is written by one side only. The indices are
+ * free running sample counts, so they are also the stream positions of the
+ * samples. A block which does not fit is dropped and counted as an overrun,
+ * samples not released by the consumer are never overwritten.
+ */
+class AudioRing {
+public:
+    /**
+     * @brief       Constructor.
+     * @param[in]   buffer      Sample storage.
+     * @param[in]   capacity    Number of samples in the storage, a power of two.
+     */
+    AudioRing(int16_t* buffer, uint32_t capacity);
+
+    /**
+     * @brief   Gets the number of samples the producer can write.
+     * @return  Number of samples.
+     */
+    uint32_t GetFreeSpace() const;
+
+    /**
+     * @brief       Gets the storage of a sample to be written by the producer.
+     * @param[in]   offset  Offset of the sample from the head.
+     * @param[out]  count   Number of samples which can be written contiguously.
+     * @return      Pointer to the sample storage.
+     */
+    int16_t* GetWritePointer(uint32_t offset, uint32_t& count);
+
+    /**
+     * @brief       Publishes samples written by the producer to the consumer.
+     * @param[in]   count   Number of samples, not more than GetFreeSpace().
+     */
+    void Commit(uint32_t count);
+
+    /**
+     * @brief       Counts a block dropped by the producer.
+     * @param[in]   count   Number of samples in the block.
+     */
+    void CountOverrun(uint32_t count);
+
+    /**
+     * @brief   Gets the samples available to the consumer.
+     * @return  View of the samples, from the tail to the head.
+     */
+    AudioView GetReadView() const;
+
+    /**
+     * @brief       Releases samples read by the consumer to the producer.
+     * @param[in]   count   Number of samples, not more than the read view size.
+     */
+    void Release(uint32_t count);
+
+    /**
+     * @brief   Gets the number of blocks dropped by the producer.
+     * @return  Number of overruns.
+     */
+    uint32_t GetOverrunCount() const;
+
+    /**
+     * @brief   Gets the number of samples dropped by the producer, the stream
+     *          time of a sample is its position plus the samples dropped before.
+     * @return  Number of dropped samples.
+     */
+    uint32_t GetDroppedSamples() const;
+
+private:
+    int16_t*              m_buffer;
+    uint32_t              m_capacity;
+    std::atomic<uint32_t> m_head;       /* Written by the producer */
+    std::atomic<uint32_t> m_tail;       /* Written by the consumer */
+    std::atomic<uint32_t> m_overruns;   /* Written by the producer */
+    std::atomic<uint32_t> m_dropped;    /* Written by the producer */
+};
+
+#endif /* AUDIO_RING_HPP */
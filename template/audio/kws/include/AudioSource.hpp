@@ -21,10 +21,15 @@
 
 #include <cstdint>
 
+#include "AudioRing.hpp"
+
 bool open_audio_source(const uint32_t idx);
 void close_audio_source(const uint32_t idx);
 const char* get_audio_name(const uint32_t idx);
-const int16_t* get_audio_array(const uint32_t idx);
-uint32_t get_audio_array_size(const uint32_t idx);
+AudioView get_audio_view(const uint32_t idx);
+void release_audio_samples(const uint32_t idx, const uint32_t count);
+uint32_t get_audio_overrun_count(void);
+uint32_t get_audio_dropped_samples(void);
+bool is_audio_speech(const uint32_t idx, const AudioView& window);
 
 #endif /* AUDIO_SOURCE_HPP__ */
\ No newline at end of file
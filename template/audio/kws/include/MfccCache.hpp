@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MFCC_CACHE_HPP
+#define MFCC_CACHE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "AudioRing.hpp"
+#include "MicroNetKwsMfcc.hpp"
+#include "TensorFlowLiteMicro.hpp"
+
+/**
+ * @brief   Streaming MFCC feature cache for overlapping inference windows.
+ *
+ * The quantized MFCC frames of the last window are kept in a ring, keyed by
+ * the absolute sample position of the audio stream. A window overlapping the
+ * previous one computes only the frames that are not in the ring yet and
+ * the model input tensor is rebuilt from the ring.
+ */
+class MfccCache {
+public:
+    /**
+     * @brief       Constructor.
+     * @param[in]   inputTensor     Model input tensor, filled with the features.
+     * @param[in]   numFeatures     Number of MFCC features per frame.
+     * @param[in]   numFrames       Number of MFCC frames per inference window.
+     * @param[in]   frameLength     MFCC frame length in samples.
+     * @param[in]   frameStride     MFCC frame stride in samples.
+     */
+    MfccCache(TfLiteTensor* inputTensor, uint32_t numFeatures, uint32_t numFrames,
+              uint32_t frameLength, uint32_t frameStride);
+
+    /**
+     * @brief   Initialises the MFCC calculation and checks the input tensor.
+     * @return  true if successful, false otherwise.
+     */
+    bool Init();
+
+    /**
+     * @brief       Computes the MFCC frames of an inference window which are
+     *              not cached yet and fills the input tensor.
+     * @param[in]   window  Audio samples of the window, GetWindowSize() long.
+     *                      Its stream position identifies the cached frames.
+     * @return      true if successful, false otherwise.
+     */
+    bool Update(const AudioView& window);
+
+    /**
+     * @brief   Drops the cached frames.
+     */
+    void Reset();
+
+    /**
+     * @brief   Gets the number of audio samples of an inference window.
+     * @return  Window size in samples.
+     */
+    uint32_t GetWindowSize() const;
+
+    /**
+     * @brief   Gets the number of frames computed by the last Update().
+     * @return  Number of computed frames.
+     */
+    uint32_t GetComputedFrames() const;
+
+private:
+    arm::app::audio::MicroNetKwsMFCC m_mfcc;
+    TfLiteTensor*        m_inputTensor;
+    uint32_t             m_numFeatures;
+    uint32_t             m_numFrames;
+    uint32_t             m_frameLength;
+    uint32_t             m_frameStride;
+    float                m_quantScale;
+    int                  m_quantOffset;
+    std::vector<int16_t> m_frameAudio;  /* Audio samples of the computed frame */
+    std::vector<int8_t>  m_frames;      /* Ring of quantized frames */
+    uint32_t             m_head;        /* Ring slot of the oldest frame */
+    uint32_t             m_count;       /* Number of cached frames */
+    uint32_t             m_position;    /* Stream position of the oldest frame */
+    uint32_t             m_computed;    /* Frames computed by the last update */
+};
+
+#endif /* MFCC_CACHE_HPP */
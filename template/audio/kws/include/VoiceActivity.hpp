@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VOICE_ACTIVITY_HPP
+#define VOICE_ACTIVITY_HPP
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief   Energy and zero crossing rate voice activity detector.
+ *
+ * The audio stream is split into frames. A frame is speech when its energy
+ * before the gain exceeds the threshold and its zero crossing rate does not
+ * exceed the maximum. The speech is extended by the hangover, the end of
+ * the last speech is published as a stream position for the consumer.
+ */
+class VoiceActivityDetector {
+public:
+    /**
+     * @brief       Constructor.
+     * @param[in]   frameSamples    Number of samples per frame.
+     * @param[in]   thresholdDb     Frame RMS threshold, in dB relative to full scale.
+     * @param[in]   zcrMax          Maximum zero crossing rate of speech, in percent.
+     * @param[in]   hangoverSamples Number of samples treated as speech after a speech frame.
+     */
+    VoiceActivityDetector(uint32_t frameSamples, int32_t thresholdDb,
+                          uint32_t zcrMax, uint32_t hangoverSamples);
+
+    /**
+     * @brief       Classifies the frames of the next samples of the stream.
+     * @param[in]   samples     Mono samples, the gain already applied.
+     * @param[in]   count       Number of samples.
+     * @param[in]   gain        Gain applied to the samples.
+     */
+    void Process(const int16_t* samples, uint32_t count, int32_t gain);
+
+    /**
+     * @brief   Gets the stream position where the last speech and its hangover
+     *          end, a window starting at or after it is silent.
+     * @return  Stream position in samples.
+     */
+    uint32_t GetSpeechEnd() const;
+
+    /**
+     * @brief   Gets the number of frames classified as speech.
+     * @return  Number of speech frames.
+     */
+    uint32_t GetSpeechFrames() const;
+
+    /**
+     * @brief   Gets the number of classified frames.
+     * @return  Number of frames.
+     */
+    uint32_t GetFrames() const;
+
+private:
+    /**
+     * @brief   Classifies the completed frame and starts the next one.
+     */
+    void EndFrame();
+
+    uint32_t              m_frameSamples;
+    uint64_t              m_threshold;      /* Frame energy threshold (sum of squares) */
+    uint32_t              m_crossingsMax;   /* Maximum zero crossings of a speech frame */
+    uint32_t              m_hangover;       /* Hangover in samples */
+    uint32_t              m_position;       /* Stream position of the next sample */
+    uint32_t              m_count;          /* Samples in the current frame */
+    uint64_t              m_energy;         /* Energy of the current frame before the gain */
+    uint32_t              m_crossings;      /* Zero crossings of the current frame */
+    bool                  m_negative;       /* Sign of the last sample */
+    std::atomic<uint32_t> m_speechEnd;      /* Read by the consumer */
+    std::atomic<uint32_t> m_speechFrames;   /* Read by the consumer */
+    std::atomic<uint32_t> m_frames;         /* Read by the consumer */
+};
+
+#endif /* VOICE_ACTIVITY_HPP */
@@ -0,0 +1,66 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef AUDIO_PROCESSING_FUNC_H__
+#define AUDIO_PROCESSING_FUNC_H__
+
+#include <stdint.h>
+
+/* Statistics of an audio block */
+typedef struct {
+  int32_t sum;      ///< Sum of the samples
+  int16_t min;      ///< Minimum sample value
+  int16_t max;      ///< Maximum sample value
+} audio_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Compute the statistics of an audio block in a single pass.
+ *
+ * The sum, minimum and maximum match arm_mean_q15 (before the division),
+ * arm_min_no_idx_q15 and arm_max_no_idx_q15 of the same samples.
+ *
+ * @param src    Pointer to the samples.
+ * @param count  Number of samples, at most 65536.
+ * @param stats  Pointer to the computed statistics.
+ */
+void audio_block_stats(const int16_t *src, uint32_t count, audio_stats_t *stats);
+
+/**
+ * @brief Condition interleaved stereo samples and convert them to mono.
+ *
+ * Every sample is shifted by the offset, multiplied by the scale and
+ * clipped to the int16_t range, the mono sample is then the sum of the
+ * halved left and right samples. The stereo samples are not modified.
+ *
+ * @param stereo  Pointer to the interleaved stereo samples.
+ * @param mono    Pointer to the mono samples.
+ * @param frames  Number of stereo frames (mono samples).
+ * @param offset  Offset added to every sample, in the range [-32768, 32768].
+ * @param scale   Scale (gain) applied after the offset, in the range [1, 1024].
+ */
+void audio_condition_to_mono(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                             int32_t offset, int32_t scale);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* AUDIO_PROCESSING_FUNC_H__ */
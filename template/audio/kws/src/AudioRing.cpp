@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AudioRing.hpp"
+
+#include <cstring>
+
+AudioView::AudioView()
+    : m_buffer{nullptr},
+      m_capacity{0},
+      m_start{0},
+      m_size{0},
+      m_position{0}
+{
+}
+
+AudioView::AudioView(const int16_t* buffer, uint32_t capacity, uint32_t start,
+                     uint32_t size, uint32_t position)
+    : m_buffer{buffer},
+      m_capacity{capacity},
+      m_start{start},
+      m_size{size},
+      m_position{position}
+{
+}
+
+uint32_t AudioView::GetSize() const
+{
+    return m_size;
+}
+
+uint32_t AudioView::GetPosition() const
+{
+    return m_position;
+}
+
+AudioView AudioView::GetWindow(uint32_t offset, uint32_t size) const
+{
+    if ((offset > m_size) || (size > (m_size - offset))) {
+        return AudioView();
+    }
+
+    uint32_t start = m_start + offset;
+    if (start >= m_capacity) {
+        start -= m_capacity;
+    }
+    return AudioView(m_buffer, m_capacity, start, size, m_position + offset);
+}
+
+void AudioView::Copy(uint32_t offset, uint32_t count, int16_t* dst) const
+{
+    uint32_t start = m_start + offset;
+    if (start >= m_capacity) {
+        start -= m_capacity;
+    }
+
+    /* Copy up to the end of the storage, then the wrapped part */
+    const uint32_t first = (count < (m_capacity - start)) ? count : (m_capacity - start);
+
+    memcpy(dst, &m_buffer[start], first * sizeof(int16_t));
+    memcpy(&dst[first], m_buffer, (count - first) * sizeof(int16_t));
+}
+
+AudioRing::AudioRing(int16_t* buffer, uint32_t capacity)
+    : m_buffer{buffer},
+      m_capacity{capacity},
+      m_head{0},
+      m_tail{0},
+      m_overruns{0},
+      m_dropped{0}
+{
+}
+
+uint32_t AudioRing::GetFreeSpace() const
+{
+    const uint32_t head = m_head.load(std::memory_order_relaxed);
+    const uint32_t tail = m_tail.load(std::memory_order_acquire);
+
+    return m_capacity - (head - tail);
+}
+
+int16_t* AudioRing::GetWritePointer(uint32_t offset, uint32_t& count)
+{
+    const uint32_t index = (m_head.load(std::memory_order_relaxed) + offset) & (m_capacity - 1U);
+
+    count = m_capacity - index;
+    return &m_buffer[index];
+}
+
+void AudioRing::Commit(uint32_t count)
+{
+    /* Samples are written before the head is published */
+    m_head.store(m_head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+void AudioRing::CountOverrun(uint32_t count)
+{
+    /* Dropped samples are counted before the overrun is published */
+    m_dropped.store(m_dropped.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    m_overruns.store(m_overruns.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+}
+
+AudioView AudioRing::GetReadView() const
+{
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    const uint32_t head = m_head.load(std::memory_order_acquire);
+
+    return AudioView(m_buffer, m_capacity, tail & (m_capacity - 1U), head - tail, tail);
+}
+
+void AudioRing::Release(uint32_t count)
+{
+    /* Samples are read before the tail is published */
+    m_tail.store(m_tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+uint32_t AudioRing::GetOverrunCount() const
+{
+    return m_overruns.load(std::memory_order_acquire);
+}
+
+uint32_t AudioRing::GetDroppedSamples() const
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
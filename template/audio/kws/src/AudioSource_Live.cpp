@@ -19,35 +19,47 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "AppConfiguration.hpp"
 #include "AudioSource.hpp"
+#include "audio_processing_func.h"
+#include "VoiceActivity.hpp"
 #include "cmsis_vstream.h"
 #include "cmsis_os2.h"
 
 #include "log_macros.h"
-#include "arm_math.h"
 
 /* Define stereo (audio in) and mono (audio for inference) buffers */
+#define AUDIO_SAMPLING_FREQ  (16000)
+#define MONO_BLOCK_SAMPLES   ((AUDIO_SAMPLING_FREQ / 1000) * AUDIO_BLOCK_MS)
+#define MONO_RING_SAMPLES    (32768)   /* Power of two, holds an inference window and two blocks */
 #define STEREO_BLOCK_COUNT   (2)
-#define STEREO_BLOCK_SAMPLES (16000)
+#define STEREO_BLOCK_SAMPLES (MONO_BLOCK_SAMPLES * 2)
 #define STEREO_BLOCK_SIZE    (STEREO_BLOCK_SAMPLES * 2)
-#define MONO_BLOCK_COUNT     (2)
-#define MONO_BLOCK_SAMPLES   (8000)
-#define MONO_BLOCK_SIZE      (MONO_BLOCK_SAMPLES * 2)
+#define VAD_FRAME_SAMPLES    (AUDIO_SAMPLING_FREQ / 100)   /* 10 ms voice activity frame */
+
+/* One second inference window, the block being captured and the next one fit in the ring */
+static_assert((AUDIO_SAMPLING_FREQ + (2 * MONO_BLOCK_SAMPLES)) <= MONO_RING_SAMPLES,
+              "Audio block too long for the mono ring");
 
 int16_t stereoBuffer[STEREO_BLOCK_SAMPLES * STEREO_BLOCK_COUNT];
-int16_t monoBuffer[MONO_BLOCK_SAMPLES * MONO_BLOCK_COUNT];
+int16_t monoBuffer[MONO_RING_SAMPLES];
+
+/* Mono buffer ring, written by the capture thread and read by the application thread */
+static AudioRing monoRing(monoBuffer, MONO_RING_SAMPLES);
 
-uint32_t mono_block;
+#if (VAD_GATE != 0)
+/* Voice activity of the mono audio, classified by the capture thread */
+static VoiceActivityDetector voiceActivity(VAD_FRAME_SAMPLES, VAD_ENERGY_THRESHOLD_DB, VAD_ZCR_MAX,
+                                           (AUDIO_SAMPLING_FREQ / 1000) * VAD_HANGOVER_MS);
+#endif
 
 /* Reference to the underlying CMSIS vStream driver */
 extern vStreamDriver_t          Driver_vStreamAudioIn;
 #define vStream_AudioIn       (&Driver_vStreamAudioIn)
 
 /* Audio processing functions */
-static int32_t CalculateOffset(int16_t *audioData, uint32_t sampleCount);
-static int32_t CalculateScale(int16_t *audioData, uint32_t sampleCount);
-static void ApplyGainAndOffset(int16_t *audioData, uint32_t sampleCount, int32_t audioOffset, int32_t audioScale);
-static void ConvertToMono(int16_t *stereoData, int16_t *monoData, uint32_t sampleCount);
+static int32_t CalculateOffset(const audio_stats_t *audioStats, uint32_t sampleCount);
+static int32_t CalculateScale(const audio_stats_t *audioStats);
 
 osThreadId_t tid_app_main = NULL;
 osThreadId_t tid_audio_capture = NULL;
@@ -63,10 +75,11 @@ void AudioDrv_Event_Callback (uint32_t event) {
 */
 void audio_capture (void *arg) {
   int16_t *buf;
+  audio_stats_t audioStats;
   int32_t audioGain   = 0;
   int32_t audioOffset = 0;
-
-  mono_block = 0;
+  int16_t *monoData;
+  uint32_t monoCount;
 
   /* Initialize audio in stream and set the receive buffer */
   vStream_AudioIn->Initialize(AudioDrv_Event_Callback);
@@ -82,53 +95,49 @@ void audio_capture (void *arg) {
       /* Process block of currently received audio samples */
       buf = (int16_t *)vStream_AudioIn->GetBlock();
 
-      /* Recalculate offset and gain */
-      audioOffset = CalculateOffset(buf, STEREO_BLOCK_SAMPLES);
-      audioGain = CalculateScale(buf, STEREO_BLOCK_SAMPLES);
-
-      /* Apply offset and scaling factor (gain) to each audio sample */
-      ApplyGainAndOffset(buf, STEREO_BLOCK_SAMPLES, audioOffset, audioGain);
-
-      /* Move mono buffer data to the beginning (shift by one block) */
-      memcpy(monoBuffer, &monoBuffer[MONO_BLOCK_SAMPLES], MONO_BLOCK_SAMPLES * (MONO_BLOCK_COUNT - 1) * 2);
-
-      /* Populate the last block of the mono buffer from the freshly captured stereo audio */
-      ConvertToMono(&monoBuffer[MONO_BLOCK_SAMPLES * (MONO_BLOCK_COUNT - 1)], buf, MONO_BLOCK_SAMPLES);
+      if (monoRing.GetFreeSpace() < MONO_BLOCK_SAMPLES) {
+        /* Application thread lags behind, drop the block */
+        monoRing.CountOverrun(MONO_BLOCK_SAMPLES);
+        vStream_AudioIn->ReleaseBlock();
+        continue;
+      }
+
+      /* Recalculate offset and gain from the statistics of the block */
+      audio_block_stats(buf, STEREO_BLOCK_SAMPLES, &audioStats);
+      audioOffset = CalculateOffset(&audioStats, STEREO_BLOCK_SAMPLES);
+      audioGain = CalculateScale(&audioStats);
+      debug("Scale: %d; Offset: %d\n", audioGain, audioOffset);
+
+      /* Apply offset and scaling factor (gain) to each audio sample and append
+       * the mono audio to the ring, in two parts when the block wraps around
+       * the end of the ring */
+      for (uint32_t n = 0; n < MONO_BLOCK_SAMPLES; n += monoCount) {
+        monoData  = monoRing.GetWritePointer(n, monoCount);
+        monoCount = std::min<uint32_t>(monoCount, MONO_BLOCK_SAMPLES - n);
+        audio_condition_to_mono(&buf[n * 2], monoData, monoCount, audioOffset, audioGain);
+#if (VAD_GATE != 0)
+        voiceActivity.Process(monoData, monoCount, audioGain);
+#endif
+      }
 
       /* Release buffer block to vStream driver */
       vStream_AudioIn->ReleaseBlock();
 
-      /* Mono buffer is ready, start processing it */
+      /* Mono block is ready, start processing it */
+      monoRing.Commit(MONO_BLOCK_SAMPLES);
       osThreadFlagsSet(tid_app_main, 0x0001);
   }
 }
 
-/*
-  Convert stereo audio data to mono.
-  The function takes stereo audio data (2 channels) and converts it to mono by
-  averaging the two channels.
-*/
-static void ConvertToMono(int16_t *monoData, int16_t *stereoData, uint32_t n_samples)
-{
-    int16_t* pIn  = stereoData;
-    int16_t* pOut = monoData;
-
-    for (int i = 0; i < n_samples; i++){
-        pOut[i] = ((pIn[0] >> 1) + (pIn[1] >> 1));
-
-        pIn += 2;
-    }
-}
-
 /*
   Calculate offset correction value.
   Offset determines how much the audio signal should be shifted up or down to
   center it around zero.
 */
-static int32_t CalculateOffset(int16_t *audioData, uint32_t sampleCount)
+static int32_t CalculateOffset(const audio_stats_t *audioStats, uint32_t sampleCount)
 {
-    int16_t audioMean = 0;
-    arm_mean_q15(audioData, sampleCount, &audioMean);
+    /* Mean as computed by arm_mean_q15 */
+    const int16_t audioMean = static_cast<int16_t>(audioStats->sum / static_cast<int32_t>(sampleCount));
     return static_cast<int32_t>(0 - audioMean);
 }
 
@@ -137,7 +146,7 @@ static int32_t CalculateOffset(int16_t *audioData, uint32_t sampleCount)
   The scaling factor is used to normalize or amplify the audio signal to a
   desired range (avoiding over-amplifying noise or silence).
 */
-static int32_t CalculateScale(int16_t *audioData, uint32_t sampleCount)
+static int32_t CalculateScale(const audio_stats_t *audioStats)
 {
     /* Define the desired signal span to scale our input signal to. It can be based on
      * the training data set, or close to std::numeric_limits<int16_t>::max()/2; */
@@ -147,13 +156,10 @@ static int32_t CalculateScale(int16_t *audioData, uint32_t sampleCount)
      * lead to false detections. */
     constexpr int32_t maxScale = 25;
 
-    int16_t audioMin = 0;
-    arm_min_no_idx_q15(audioData, sampleCount, &audioMin);
-
-    int16_t audioMax = 0;
-    arm_max_no_idx_q15(audioData, sampleCount, &audioMax);
+    const int32_t audioSpan = audioStats->max - audioStats->min;
 
-    int32_t audioScale = desirableSignalSpan / (audioMax - audioMin);
+    /* A constant signal gets the minimum gain */
+    int32_t audioScale = (audioSpan != 0) ? (desirableSignalSpan / audioSpan) : 0;
 
     /* We don't want random silence to be amplified too much; we limit
      * the gain */
@@ -166,33 +172,6 @@ static int32_t CalculateScale(int16_t *audioData, uint32_t sampleCount)
     return audioScale;
 }
 
-/*
-  Apply gain and offset to the audio data.
-  Applies linear transformation with gain and offset and ensures that the values
-  stay within the range of int16_t.
-*/
-static void ApplyGainAndOffset(int16_t *audioData, uint32_t sampleCount, int32_t audioOffset, int32_t audioScale)
-{
-    debug("Scale: %d; Offset: %d\n", audioScale, audioOffset);
-    int16_t* buf = static_cast<int16_t*>(audioData);
-
-    /* Apply offset first and then gain */
-    for (uint32_t i = 0; i < sampleCount; ++i) {
-        auto& sample         = buf[i];
-        int32_t modified_val = (static_cast<int32_t>(sample) + audioOffset) * audioScale;
-
-        /* Clip the high end */
-        modified_val = std::min<int32_t>(modified_val,
-                                         static_cast<int32_t>(std::numeric_limits<int16_t>::max()));
-
-        /* Clip the low end */
-        modified_val = std::max<int32_t>(modified_val,
-                                         static_cast<int32_t>(std::numeric_limits<int16_t>::min()));
-
-        sample = static_cast<int16_t>(modified_val);
-    }
-}
-
 bool open_audio_source(const uint32_t idx)
 {
     uint32_t flags;
@@ -201,8 +180,12 @@ bool open_audio_source(const uint32_t idx)
       /* Get application thread ID */
       tid_app_main = osThreadGetId();
 
-      /* Create audio capture thread */
-      tid_audio_capture = osThreadNew(audio_capture, NULL, NULL);
+      /* Create audio capture thread, above the application thread so that
+       * short blocks are taken from the driver while the inference runs */
+      const osThreadAttr_t attr = {
+        .priority = osPriorityAboveNormal,
+      };
+      tid_audio_capture = osThreadNew(audio_capture, NULL, &attr);
     }
 
     /* Wait for flag from audio capture thread (2 sec timeout) */
@@ -228,14 +211,40 @@ const char* get_audio_name(const uint32_t idx)
     return "Live Audio Stream";
 }
 
-const int16_t* get_audio_array(const uint32_t idx)
+AudioView get_audio_view(const uint32_t idx)
 {
-    /* Mono buffer is the audio source array */
-    return monoBuffer;
+    /* Samples captured and not released yet */
+    (void)idx;
+    return monoRing.GetReadView();
 }
 
-uint32_t get_audio_array_size(const uint32_t idx)
+void release_audio_samples(const uint32_t idx, const uint32_t count)
 {
-    /* Return number of elements in audio array */
-    return MONO_BLOCK_SAMPLES * MONO_BLOCK_COUNT;
+    /* Released samples can be overwritten by the capture thread */
+    (void)idx;
+    monoRing.Release(count);
+}
+
+uint32_t get_audio_overrun_count(void)
+{
+    return monoRing.GetOverrunCount();
+}
+
+uint32_t get_audio_dropped_samples(void)
+{
+    return monoRing.GetDroppedSamples();
+}
+
+bool is_audio_speech(const uint32_t idx, const AudioView& window)
+{
+    (void)idx;
+#if (VAD_GATE != 0)
+    /* Speech frames of the window are classified before its samples are
+     * committed to the ring. A window is speech when the last speech and
+     * its hangover end after the window start. */
+    return static_cast<int32_t>(voiceActivity.GetSpeechEnd() - window.GetPosition()) > 0;
+#else
+    (void)window;
+    return true;
+#endif
 }
@@ -56,19 +56,43 @@ const char* get_audio_name(const uint32_t idx)
     return nullptr;
 }
  
-const int16_t* get_audio_array(const uint32_t idx)
+AudioView get_audio_view(const uint32_t idx)
 {
-    if (idx < NUMBER_OF_FILES) {
-        return audio_clip_arrays[idx];
+    if (idx >= NUMBER_OF_FILES) {
+        return AudioView();
     }
-    return nullptr;
+
+    /* Clips follow each other in the stream, so they do not share positions */
+    uint32_t position = 0;
+
+    for (uint32_t i = 0; i < idx; i++) {
+        position += audio_clip_sizes[i];
+    }
+    return AudioView(audio_clip_arrays[idx], audio_clip_sizes[idx], 0, audio_clip_sizes[idx], position);
 }
- 
-uint32_t get_audio_array_size(const uint32_t idx)
+
+void release_audio_samples(const uint32_t idx, const uint32_t count)
+{
+    /* Clip data is constant */
+    (void)idx;
+    (void)count;
+}
+
+uint32_t get_audio_overrun_count(void)
+{
+    return 0;
+}
+
+uint32_t get_audio_dropped_samples(void)
 {
-    if (idx < NUMBER_OF_FILES) {
-        return audio_clip_sizes[idx];
-    }
     return 0;
 }
+
+bool is_audio_speech(const uint32_t idx, const AudioView& window)
+{
+    /* Clips are always inferred */
+    (void)idx;
+    (void)window;
+    return true;
+}
  
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MfccCache.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+#include "log_macros.h"
+
+MfccCache::MfccCache(TfLiteTensor* inputTensor, uint32_t numFeatures, uint32_t numFrames,
+                     uint32_t frameLength, uint32_t frameStride)
+    : m_mfcc{numFeatures, frameLength},
+      m_inputTensor{inputTensor},
+      m_numFeatures{numFeatures},
+      m_numFrames{numFrames},
+      m_frameLength{frameLength},
+      m_frameStride{frameStride},
+      m_quantScale{1.0f},
+      m_quantOffset{0},
+      m_frameAudio(frameLength),
+      m_frames(numFrames * numFeatures),
+      m_head{0},
+      m_count{0},
+      m_position{0},
+      m_computed{0}
+{
+}
+
+bool MfccCache::Init()
+{
+    if (m_inputTensor->type != kTfLiteInt8) {
+        printf_err("MFCC cache supports int8 input tensor only\n");
+        return false;
+    }
+    if (m_inputTensor->bytes < (m_numFrames * m_numFeatures)) {
+        printf_err("Input tensor too small for %" PRIu32 " MFCC frames\n", m_numFrames);
+        return false;
+    }
+
+    const arm::app::QuantParams quantParams = arm::app::GetTensorQuantParams(m_inputTensor);
+    m_quantScale  = quantParams.scale;
+    m_quantOffset = quantParams.offset;
+
+    m_mfcc.Init();
+    Reset();
+    return true;
+}
+
+bool MfccCache::Update(const AudioView& window)
+{
+    const uint32_t position = window.GetPosition();
+
+    if (window.GetSize() < GetWindowSize()) {
+        printf_err("Audio window too short for %" PRIu32 " MFCC frames\n", m_numFrames);
+        return false;
+    }
+
+    /* Drop the frames which precede the window, keep the overlapping ones.
+     * The ring is dropped when the window is not aligned to the cached
+     * frames or does not overlap them (new clip, lost audio). */
+    if (m_count != 0) {
+        const uint32_t offset = position - m_position;
+        if (((offset % m_frameStride) == 0) && ((offset / m_frameStride) < m_count)) {
+            const uint32_t dropped = offset / m_frameStride;
+            m_head   = (m_head + dropped) % m_numFrames;
+            m_count -= dropped;
+        } else {
+            Reset();
+        }
+    }
+    m_position = position;
+    m_computed = m_numFrames - m_count;
+
+    /* Compute and quantize the new frames at the end of the window */
+    for (uint32_t i = m_count; i < m_numFrames; i++) {
+        window.Copy(i * m_frameStride, m_frameLength, m_frameAudio.data());
+
+        const std::vector<int8_t> features =
+            m_mfcc.MfccComputeQuant<int8_t>(m_frameAudio, m_quantScale, m_quantOffset);
+        if (features.size() != m_numFeatures) {
+            printf_err("Unexpected number of MFCC features\n");
+            Reset();
+            return false;
+        }
+
+        const uint32_t slot = (m_head + i) % m_numFrames;
+        std::copy(features.begin(), features.end(), &m_frames[slot * m_numFeatures]);
+    }
+    m_count = m_numFrames;
+
+    /* Rebuild the input tensor from the ring, oldest frame first */
+    int8_t* tensorData = tflite::GetTensorData<int8_t>(m_inputTensor);
+    const uint32_t tail = (m_numFrames - m_head) * m_numFeatures;
+
+    memcpy(tensorData, &m_frames[m_head * m_numFeatures], tail);
+    memcpy(&tensorData[tail], &m_frames[0], m_head * m_numFeatures);
+
+    return true;
+}
+
+void MfccCache::Reset()
+{
+    m_head  = 0;
+    m_count = 0;
+}
+
+uint32_t MfccCache::GetWindowSize() const
+{
+    return ((m_numFrames - 1) * m_frameStride) + m_frameLength;
+}
+
+uint32_t MfccCache::GetComputedFrames() const
+{
+    return m_computed;
+}
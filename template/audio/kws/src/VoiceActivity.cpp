@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VoiceActivity.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "arm_math.h"
+
+/* Largest distance of the speech end behind the stream position, keeps the
+ * wrap-around comparison of the consumer valid during long silence */
+#define SPEECH_END_MAX_AGE  (1UL << 30)
+
+VoiceActivityDetector::VoiceActivityDetector(uint32_t frameSamples, int32_t thresholdDb,
+                                             uint32_t zcrMax, uint32_t hangoverSamples)
+    : m_frameSamples{frameSamples},
+      m_threshold{0},
+      m_crossingsMax{(zcrMax * frameSamples) / 100U},
+      m_hangover{hangoverSamples},
+      m_position{0},
+      m_count{0},
+      m_energy{0},
+      m_crossings{0},
+      m_negative{false},
+      m_speechEnd{0},
+      m_speechFrames{0},
+      m_frames{0}
+{
+    /* Sum of squares of a frame at the threshold RMS level */
+    const double rms = 32768.0 * std::pow(10.0, thresholdDb / 20.0);
+    m_threshold = static_cast<uint64_t>(rms * rms * frameSamples);
+}
+
+void VoiceActivityDetector::Process(const int16_t* samples, uint32_t count, int32_t gain)
+{
+    const uint64_t gainSquared = static_cast<uint64_t>(gain) * static_cast<uint64_t>(gain);
+
+    while (count != 0) {
+        const uint32_t n = std::min(count, m_frameSamples - m_count);
+
+        /* Energy of the frame part, sum of squares in 34.30 format */
+        q63_t power = 0;
+        arm_power_q15(samples, n, &power);
+        m_energy += static_cast<uint64_t>(power) / gainSquared;
+
+        /* Zero crossings, counted from the last sample of the previous part */
+        for (uint32_t i = 0; i < n; i++) {
+            const bool negative = (samples[i] < 0);
+            m_crossings += (negative != m_negative) ? 1U : 0U;
+            m_negative = negative;
+        }
+
+        m_count    += n;
+        m_position += n;
+        samples    += n;
+        count      -= n;
+
+        if (m_count == m_frameSamples) {
+            EndFrame();
+        }
+    }
+}
+
+void VoiceActivityDetector::EndFrame()
+{
+    const bool speech = (m_energy > m_threshold) && (m_crossings <= m_crossingsMax);
+    uint32_t speechEnd = m_speechEnd.load(std::memory_order_relaxed);
+
+    if (speech) {
+        speechEnd = m_position + m_hangover;
+        m_speechFrames.store(m_speechFrames.load(std::memory_order_relaxed) + 1U,
+                             std::memory_order_relaxed);
+    } else if (static_cast<int32_t>(m_position - speechEnd) > static_cast<int32_t>(SPEECH_END_MAX_AGE)) {
+        speechEnd = m_position - SPEECH_END_MAX_AGE;
+    }
+    m_speechEnd.store(speechEnd, std::memory_order_relaxed);
+    m_frames.store(m_frames.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+
+    m_count     = 0;
+    m_energy    = 0;
+    m_crossings = 0;
+}
+
+uint32_t VoiceActivityDetector::GetSpeechEnd() const
+{
+    return m_speechEnd.load(std::memory_order_relaxed);
+}
+
+uint32_t VoiceActivityDetector::GetSpeechFrames() const
+{
+    return m_speechFrames.load(std::memory_order_relaxed);
+}
+
+uint32_t VoiceActivityDetector::GetFrames() const
+{
+    return m_frames.load(std::memory_order_relaxed);
+}
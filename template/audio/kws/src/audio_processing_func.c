@@ -0,0 +1,59 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "cmsis_compiler.h"
+#include "audio_processing_func.h"
+
+/*
+  Clamp a value to the int16_t range.
+
+  \param[in] val  The value to clamp.
+  \return         The clamped value.
+*/
+static inline int16_t clamp_q15(int32_t val) {
+  return (int16_t)((val < INT16_MIN) ? INT16_MIN : (val > INT16_MAX) ? INT16_MAX : val);
+}
+
+__WEAK void audio_block_stats(const int16_t *src, uint32_t count, audio_stats_t *stats) {
+  int32_t sum = 0;
+  int16_t min = INT16_MAX;
+  int16_t max = INT16_MIN;
+
+  for (uint32_t i = 0; i < count; i++) {
+    const int16_t val = src[i];
+    sum += val;
+    min = (val < min) ? val : min;
+    max = (val > max) ? val : max;
+  }
+
+  stats->sum = sum;
+  stats->min = min;
+  stats->max = max;
+}
+
+__WEAK void audio_condition_to_mono(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                                    int32_t offset, int32_t scale) {
+  for (uint32_t i = 0; i < frames; i++) {
+    const int16_t left  = clamp_q15((stereo[0] + offset) * scale);
+    const int16_t right = clamp_q15((stereo[1] + offset) * scale);
+
+    mono[i] = (int16_t)((left >> 1) + (right >> 1));
+    stereo += 2;
+  }
+}
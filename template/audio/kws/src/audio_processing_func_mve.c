@@ -0,0 +1,88 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Helium (MVE) implementations of the audio processing functions.
+
+  Functions in this file override the __WEAK scalar defaults from
+  audio_processing_func.c when the target supports the M-profile Vector
+  Extension (Cortex-M55, Cortex-M85). Results are bit-exact with the scalar
+  versions.
+*/
+
+#include <stdint.h>
+#include "cmsis_compiler.h"
+#include "audio_processing_func.h"
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+
+#include <arm_mve.h>
+
+/*
+  Helium block statistics, eight samples per iteration. The minimum and
+  maximum are kept per lane and reduced after the loop, the tail is handled
+  with predication.
+*/
+void audio_block_stats(const int16_t *src, uint32_t count, audio_stats_t *stats) {
+  int16x8_t vmin = vdupq_n_s16(INT16_MAX);
+  int16x8_t vmax = vdupq_n_s16(INT16_MIN);
+  int32_t sum = 0;
+
+  for (int32_t n = (int32_t)count; n > 0; n -= 8) {
+    const mve_pred16_t p = vctp16q((uint32_t)n);
+    const int16x8_t val = vldrhq_z_s16(src, p);
+
+    sum  = vaddvaq_p_s16(sum, val, p);
+    vmin = vminq_m_s16(vmin, vmin, val, p);
+    vmax = vmaxq_m_s16(vmax, vmax, val, p);
+    src += 8;
+  }
+
+  stats->sum = sum;
+  stats->min = vminvq_s16(INT16_MAX, vmin);
+  stats->max = vmaxvq_s16(INT16_MIN, vmax);
+}
+
+/*
+  Helium stereo to mono conditioning, four frames per iteration. The left
+  (even) and right (odd) samples are widened to 32 bits, so the offset and
+  scale are applied without overflow before clipping. The mono samples are
+  narrowed by the 16-bit store.
+*/
+void audio_condition_to_mono(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                             int32_t offset, int32_t scale) {
+  const int32x4_t lo = vdupq_n_s32(INT16_MIN);
+  const int32x4_t hi = vdupq_n_s32(INT16_MAX);
+
+  for (int32_t n = (int32_t)frames; n > 0; n -= 4) {
+    const mve_pred16_t p = vctp32q((uint32_t)n);
+    const int16x8_t val = vldrhq_z_s16(stereo, vctp16q((uint32_t)n * 2U));
+
+    int32x4_t left  = vmulq_n_s32(vaddq_n_s32(vmovlbq_s16(val), offset), scale);
+    int32x4_t right = vmulq_n_s32(vaddq_n_s32(vmovltq_s16(val), offset), scale);
+
+    left  = vminq_s32(vmaxq_s32(left, lo), hi);
+    right = vminq_s32(vmaxq_s32(right, lo), hi);
+
+    vstrhq_p_s32(mono, vaddq_s32(vshrq_n_s32(left, 1), vshrq_n_s32(right, 1)), p);
+    stereo += 8;
+    mono   += 4;
+  }
+}
+
+#endif /* defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1) */
@@ -24,18 +24,21 @@
  * the memory requirements for TensorFlow Lite Micro framework and
  * some heap for the API runtime.
  */
+#include <cinttypes>
 #include <cstdint>
 #include <string>
 #include <vector>
 
+#include "AppConfiguration.hpp" /* Application configuration */
 #include "AudioUtils.hpp"
 #include "AudioSource.hpp"      /* Interface to audio data array */
 
 #include "BufAttributes.hpp"    /* Buffer attributes to be applied */
 #include "Classifier.hpp"       /* Classifier for the result */
+#include "HeapMonitor.hpp"      /* Heap allocation monitor */
 #include "KwsProcessing.hpp"    /* Pre and Post Process */
-#include "KwsResult.hpp"        /* KWS results class */
 #include "Labels.hpp"           /* Label Data for the model */
+#include "MfccCache.hpp"        /* Streaming MFCC feature cache */
 #include "MicroNetKwsModel.hpp" /* Model API */
 
 #include "cmsis_os2.h"          /* CMSIS-RTOS2 API */
@@ -73,6 +76,13 @@ void app_main_thread(void *arg)
     constexpr auto mfccFrameStride = 320;
     constexpr auto scoreThreshold = 0.7f;
 
+    /* Inference hop in samples, the MFCC frames of consecutive windows
+     * are aligned when it is a multiple of the MFCC frame stride. */
+    constexpr uint32_t samplingFreq = audio::MicroNetKwsMFCC::ms_defaultSamplingFreq;
+    constexpr uint32_t windowStride = (KWS_INFERENCE_HOP_MS * samplingFreq) / 1000U;
+    static_assert((windowStride != 0) && ((windowStride % mfccFrameStride) == 0),
+                  "Inference hop must be a multiple of the MFCC frame stride");
+
     /* Get Input and Output tensors for pre/post processing. */
     TfLiteTensor* inputTensor  = model.GetInputTensor(0);
     TfLiteTensor* outputTensor = model.GetOutputTensor(0);
@@ -90,57 +100,96 @@ void app_main_thread(void *arg)
     const uint32_t numMfccFeatures = inputShape->data[MicroNetKwsModel::ms_inputColsIdx];
     const uint32_t numMfccFrames   = inputShape->data[MicroNetKwsModel::ms_inputRowsIdx];
 
-    /* We expect to be sampling 1 second worth of data at a time.
-     * NOTE: This is only used for time stamp calculation. */
-    const float secondsPerSample = 1.0 / audio::MicroNetKwsMFCC::ms_defaultSamplingFreq;
-
     /* Classifier object for results */
     KwsClassifier classifier;
 
     /* Object to hold label strings. */
     std::vector<std::string> labels;
 
-    /* Declare a container to hold results from across the whole audio clip. */
-    std::vector<kws::KwsResult> finalResults;
-
     /* Object to hold classification results */
     std::vector<ClassificationResult> singleInfResult;
 
     /* Populate the labels here. */
     GetLabelsVector(labels);
 
-    /* Set up pre and post-processing. */
-    KwsPreProcess preProcess = KwsPreProcess(inputTensor, numMfccFeatures, numMfccFrames, mfccFrameLength, mfccFrameStride);
+    /* Look up the index of the unknown label once, results are compared
+     * by label index in the loop. labels.size() stands for no keyword. */
+    const uint32_t noLabelIdx = static_cast<uint32_t>(labels.size());
+    uint32_t unknownLabelIdx = noLabelIdx;
+    for (uint32_t i = 0; i < labels.size(); i++) {
+        if (labels[i] == "_unknown_") {
+            unknownLabelIdx = i;
+            break;
+        }
+    }
+
+    /* Set up pre and post-processing. The MFCC frames of overlapping windows
+     * are computed once and kept across the audio source blocks. */
+    MfccCache mfccCache = MfccCache(inputTensor, numMfccFeatures, numMfccFrames, mfccFrameLength, mfccFrameStride);
+    if (!mfccCache.Init()) {
+        printf_err("Failed to initialise MFCC cache\n");
+        return;
+    }
     KwsPostProcess postProcess = KwsPostProcess(outputTensor, classifier, labels, singleInfResult);
 
     uint32_t file_idx = 0;
     uint32_t inferenceCount = 0;
-    std::string lastValidKeywordDetected;
+    uint32_t skippedCount = 0;
+    uint32_t lastValidKeywordDetected = noLabelIdx;
+    uint32_t overrunCount = get_audio_overrun_count();
+    uint32_t droppedSamples = get_audio_dropped_samples();
+    const uint64_t timerFreq = osKernelGetSysTimerFreq();
+
+    /* Initialisation is complete, the loop below is expected not to allocate. */
+    heap_monitor_start();
 
     while (open_audio_source(file_idx)) {
 
         debug("Using audio data from %s\n", get_audio_name(file_idx));
 
-        /* Creating a sliding window through the whole audio clip. */
-        auto audioDataSlider = audio::SlidingWindow<const int16_t>(get_audio_array(file_idx),
-                                                                   get_audio_array_size(file_idx),
-                                                                   preProcess.m_audioDataWindowSize,
-                                                                   preProcess.m_audioDataStride);
-        close_audio_source(file_idx++);
+        /* Audio samples not processed yet, in place in the audio source.
+         * The last sample has just been delivered, which is the reference
+         * for the detection latency. */
+        const AudioView audioData = get_audio_view(file_idx);
+        const uint32_t audioTime  = osKernelGetSysTimerCount();
+        const uint32_t audioEnd   = audioData.GetPosition() + audioData.GetSize();
+
+        /* Audio lost since the last block: the samples before the gap are
+         * dropped, so that no window spans it. */
+        if (get_audio_overrun_count() != overrunCount) {
+            overrunCount   = get_audio_overrun_count();
+            droppedSamples = get_audio_dropped_samples();
+            warn("Audio overrun #%" PRIu32 ", restarting the audio windows\n", overrunCount);
+            release_audio_samples(file_idx, audioData.GetSize());
+            mfccCache.Reset();
+            close_audio_source(file_idx++);
+            continue;
+        }
 
-        /* Reset sliding window position */
-        audioDataSlider.Reset();
+        /* Sliding window through the audio samples. */
+        const uint32_t windowSize = mfccCache.GetWindowSize();
+        uint32_t windowOffset = 0;
 
-        while (audioDataSlider.HasNext()) {
-            const int16_t* inferenceWindow = audioDataSlider.Next();
+        for (; (windowOffset + windowSize) <= audioData.GetSize(); windowOffset += windowStride) {
+            const AudioView inferenceWindow = audioData.GetWindow(windowOffset, windowSize);
+
+            /* Silent windows skip the feature extraction and the inference,
+             * a keyword repeated after silence is reported again. */
+            if (!is_audio_speech(file_idx, inferenceWindow)) {
+                skippedCount++;
+                lastValidKeywordDetected = noLabelIdx;
+                continue;
+            }
 
             /* Run the pre-processing, inference and post-processing. */
-            if (!preProcess.DoPreProcess(inferenceWindow, audioDataSlider.Index())) {
+            if (!mfccCache.Update(inferenceWindow)) {
                 printf_err("Pre-processing failed.");
                 return;
             }
+            debug("MFCC frames computed: %" PRIu32 "\n", mfccCache.GetComputedFrames());
 
-            info("Inference #: %" PRIu32 "\n", ++inferenceCount);
+            info("Inference #: %" PRIu32 "; Silent windows skipped: %" PRIu32 "\n",
+                 ++inferenceCount, skippedCount);
 
             if (!model.RunInference()) {
                 printf_err("Inference failed.");
@@ -152,30 +201,38 @@ void app_main_thread(void *arg)
                 return;
             }
 
-            /* Add results from this window to our final results vector. */
-            finalResults.emplace_back(kws::KwsResult(
-                singleInfResult,
-                audioDataSlider.Index() * secondsPerSample * preProcess.m_audioDataStride,
-                audioDataSlider.Index(),
-                scoreThreshold));
-        }
-
-        for (const auto& result : finalResults) {
-            if (!result.m_resultVec.empty()) {
-                /* Result vector is not empty, get the top result */
-                const auto& topResult = result.m_resultVec[0];
-                const std::string& topKeyword = topResult.m_label;
-                const float score = topResult.m_normalisedVal;
+            /* Evaluate the top result of this window. */
+            if (!singleInfResult.empty()) {
+                const uint32_t topIdx = singleInfResult[0].m_labelIdx;
+                const auto score = singleInfResult[0].m_normalisedVal;
 
-                if (topKeyword != "<none>" && topKeyword != "_unknown_" && topKeyword != lastValidKeywordDetected) {
+                if ((score >= scoreThreshold) && (topIdx < noLabelIdx) &&
+                    (topIdx != unknownLabelIdx) && (topIdx != lastValidKeywordDetected)) {
                     /* Update last keyword. */
-                    lastValidKeywordDetected = topKeyword;
-                    info("Detected: %s; Prob: %0.2f\n", topKeyword.c_str(), score);
+                    lastValidKeywordDetected = topIdx;
+
+                    /* Time of the window start in the audio stream. The latency
+                     * is measured from the capture of the last window sample,
+                     * the keyword end precedes it by up to one hop. */
+                    const uint32_t windowEnd = inferenceWindow.GetPosition() + windowSize;
+                    const float windowTime = static_cast<float>(inferenceWindow.GetPosition() + droppedSamples) /
+                                             samplingFreq;
+                    const uint32_t latencyMs = static_cast<uint32_t>(
+                        ((static_cast<uint64_t>(osKernelGetSysTimerCount() - audioTime) * 1000U) / timerFreq) +
+                        (((audioEnd - windowEnd) * 1000U) / samplingFreq));
+
+                    info("Detected: %s; Prob: %0.2f; Time: %0.2f s; Latency: %" PRIu32 " - %" PRIu32 " ms\n",
+                         labels[topIdx].c_str(), score, windowTime,
+                         latencyMs, latencyMs + KWS_INFERENCE_HOP_MS);
                 }
             }
         }
 
-        finalResults.clear();
+        /* Samples before the next window are not needed any more. */
+        release_audio_samples(file_idx, windowOffset);
+        close_audio_source(file_idx++);
+
+        heap_monitor_check("keyword loop");
     }
 }
 
@@ -0,0 +1,149 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "audio_conditioning_ref.h"
+
+/* Desired signal span and maximum scale of AudioSource_Live.cpp */
+#define DESIRABLE_SIGNAL_SPAN   18000
+#define MAX_SCALE               25
+
+/*
+  arm_mean_q15: the sum is accumulated in 32 bits and truncated by the
+  division.
+*/
+static void ref_arm_mean_q15(const int16_t *src, uint32_t blockSize, int16_t *result) {
+  int32_t sum = 0;
+
+  for (uint32_t i = 0; i < blockSize; i++) {
+    sum += src[i];
+  }
+  *result = (int16_t)(sum / (int32_t)blockSize);
+}
+
+/* arm_min_no_idx_q15 */
+static void ref_arm_min_no_idx_q15(const int16_t *src, uint32_t blockSize, int16_t *result) {
+  int16_t min = src[0];
+
+  for (uint32_t i = 1; i < blockSize; i++) {
+    min = (src[i] < min) ? src[i] : min;
+  }
+  *result = min;
+}
+
+/* arm_max_no_idx_q15 */
+static void ref_arm_max_no_idx_q15(const int16_t *src, uint32_t blockSize, int16_t *result) {
+  int16_t max = src[0];
+
+  for (uint32_t i = 1; i < blockSize; i++) {
+    max = (src[i] > max) ? src[i] : max;
+  }
+  *result = max;
+}
+
+/* CalculateOffset of the previous path */
+static int32_t ref_calculate_offset(int16_t *audioData, uint32_t sampleCount) {
+  int16_t audioMean = 0;
+  ref_arm_mean_q15(audioData, sampleCount, &audioMean);
+  return (int32_t)(0 - audioMean);
+}
+
+/*
+  CalculateScale of the previous path. A constant block divided by zero,
+  the SDIV instruction of Cortex-M gives 0 for it (division by zero trap
+  disabled), which is what the host reference uses.
+*/
+static int32_t ref_calculate_scale(int16_t *audioData, uint32_t sampleCount) {
+  int16_t audioMin = 0;
+  ref_arm_min_no_idx_q15(audioData, sampleCount, &audioMin);
+
+  int16_t audioMax = 0;
+  ref_arm_max_no_idx_q15(audioData, sampleCount, &audioMax);
+
+  const int32_t audioSpan = audioMax - audioMin;
+  int32_t audioScale = (audioSpan != 0) ? (DESIRABLE_SIGNAL_SPAN / audioSpan) : 0;
+
+  if (audioScale > MAX_SCALE) {
+    audioScale = MAX_SCALE;
+  } else if (audioScale < 1) {
+    audioScale = 1;
+  }
+  return audioScale;
+}
+
+/* ApplyGainAndOffset of the previous path */
+static void ref_apply_gain_and_offset(int16_t *audioData, uint32_t sampleCount, int32_t audioOffset, int32_t audioScale) {
+  for (uint32_t i = 0; i < sampleCount; ++i) {
+    int32_t modified_val = ((int32_t)audioData[i] + audioOffset) * audioScale;
+
+    /* Clip the high end */
+    modified_val = (modified_val < INT16_MAX) ? modified_val : INT16_MAX;
+
+    /* Clip the low end */
+    modified_val = (modified_val > INT16_MIN) ? modified_val : INT16_MIN;
+
+    audioData[i] = (int16_t)modified_val;
+  }
+}
+
+/* ConvertToMono of the previous path */
+static void ref_convert_to_mono(int16_t *monoData, int16_t *stereoData, uint32_t n_samples) {
+  int16_t *pIn  = stereoData;
+  int16_t *pOut = monoData;
+
+  for (uint32_t i = 0; i < n_samples; i++) {
+    pOut[i] = (int16_t)((pIn[0] >> 1) + (pIn[1] >> 1));
+
+    pIn += 2;
+  }
+}
+
+void ref_condition_block(int16_t *stereo, int16_t *mono, uint32_t frames,
+                         audio_conditioning_t *result) {
+  const uint32_t samples = frames * 2U;
+
+  result->offset = ref_calculate_offset(stereo, samples);
+  result->scale  = ref_calculate_scale(stereo, samples);
+  ref_apply_gain_and_offset(stereo, samples, result->offset, result->scale);
+  ref_convert_to_mono(mono, stereo, frames);
+}
+
+void fused_condition_block(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                           audio_conditioning_t *result,
+                           audio_stats_func_t stats, audio_to_mono_func_t to_mono) {
+  const uint32_t samples = frames * 2U;
+  audio_stats_t audioStats;
+
+  stats(stereo, samples, &audioStats);
+
+  /* CalculateOffset and CalculateScale of AudioSource_Live.cpp */
+  result->offset = 0 - (int16_t)(audioStats.sum / (int32_t)samples);
+
+  const int32_t audioSpan = audioStats.max - audioStats.min;
+  int32_t audioScale = (audioSpan != 0) ? (DESIRABLE_SIGNAL_SPAN / audioSpan) : 0;
+
+  if (audioScale > MAX_SCALE) {
+    audioScale = MAX_SCALE;
+  } else if (audioScale < 1) {
+    audioScale = 1;
+  }
+  result->scale = audioScale;
+
+  to_mono(stereo, mono, frames, result->offset, result->scale);
+}
@@ -0,0 +1,86 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Reference of the live audio conditioning.
+
+  The previous path of AudioSource_Live.cpp made five passes over each
+  stereo block: arm_mean_q15, arm_min_no_idx_q15 and arm_max_no_idx_q15,
+  the in-place offset and gain loop (ApplyGainAndOffset) and the stereo to
+  mono conversion (ConvertToMono). It is kept here, with the CMSIS-DSP
+  functions reimplemented for the host, to check the fused kernels from
+  audio_processing_func.c bit for bit and to time both paths.
+*/
+
+#ifndef AUDIO_CONDITIONING_REF_H__
+#define AUDIO_CONDITIONING_REF_H__
+
+#include <stdint.h>
+
+#include "audio_processing_func.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Result of conditioning one stereo block */
+typedef struct {
+  int32_t offset;   ///< Offset added to the samples
+  int32_t scale;    ///< Scale (gain) applied to the samples
+} audio_conditioning_t;
+
+/* Block statistics kernel, audio_block_stats() or its Helium version */
+typedef void (*audio_stats_func_t)(const int16_t *src, uint32_t count, audio_stats_t *stats);
+
+/* Conditioning kernel, audio_condition_to_mono() or its Helium version */
+typedef void (*audio_to_mono_func_t)(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                                     int32_t offset, int32_t scale);
+
+/**
+ * @brief Condition a stereo block with the previous five pass path.
+ *
+ * @param stereo  Pointer to the interleaved stereo samples, modified in place.
+ * @param mono    Pointer to the mono samples.
+ * @param frames  Number of stereo frames (mono samples), at least 1.
+ * @param result  Pointer to the offset and scale used.
+ */
+void ref_condition_block(int16_t *stereo, int16_t *mono, uint32_t frames,
+                         audio_conditioning_t *result);
+
+/**
+ * @brief Condition a stereo block with the fused kernels.
+ *
+ * The offset and scale are derived from the block statistics as in
+ * AudioSource_Live.cpp.
+ *
+ * @param stereo   Pointer to the interleaved stereo samples.
+ * @param mono     Pointer to the mono samples.
+ * @param frames   Number of stereo frames (mono samples), at least 1.
+ * @param result   Pointer to the offset and scale used.
+ * @param stats    Block statistics kernel.
+ * @param to_mono  Conditioning kernel.
+ */
+void fused_condition_block(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                           audio_conditioning_t *result,
+                           audio_stats_func_t stats, audio_to_mono_func_t to_mono);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUDIO_CONDITIONING_REF_H__ */
@@ -0,0 +1,31 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Host build of the Helium (MVE) audio processing functions.
+
+  The functions are renamed with an mve_ prefix, so they do not override
+  the __WEAK scalar defaults (see audio_processing_func_mve_host.h).
+*/
+
+#define __ARM_FEATURE_MVE   1
+
+#define audio_block_stats        mve_audio_block_stats
+#define audio_condition_to_mono  mve_audio_condition_to_mono
+
+#include "audio_processing_func_mve.c"
@@ -0,0 +1,46 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Helium (MVE) audio processing functions built for the host.
+
+  audio_processing_func_mve_host.c compiles audio_processing_func_mve.c
+  against the intrinsic emulation in host/arm_mve.h. Its functions are
+  exported with an mve_ prefix, so a test can compare them with the scalar
+  defaults from audio_processing_func.c in the same program.
+*/
+
+#ifndef AUDIO_PROCESSING_FUNC_MVE_HOST_H__
+#define AUDIO_PROCESSING_FUNC_MVE_HOST_H__
+
+#include "audio_processing_func.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void mve_audio_block_stats(const int16_t *src, uint32_t count, audio_stats_t *stats);
+
+void mve_audio_condition_to_mono(const int16_t *stereo, int16_t *mono, uint32_t frames,
+                                 int32_t offset, int32_t scale);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUDIO_PROCESSING_FUNC_MVE_HOST_H__ */
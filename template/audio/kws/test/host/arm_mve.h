@@ -0,0 +1,206 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Host emulation of the Helium (MVE) intrinsics used by
+  audio_processing_func_mve.c.
+
+  Vectors are plain lane arrays and every intrinsic is evaluated lane by
+  lane, following the Arm MVE intrinsics reference. A predicate holds one
+  bit per vector byte, as on the target, so a lane is active when its low
+  predicate bit is set. Only meant for checking the kernels against the
+  scalar defaults on the host, not for speed.
+*/
+
+#ifndef ARM_MVE_HOST_H
+#define ARM_MVE_HOST_H
+
+#include <stdint.h>
+
+typedef uint16_t mve_pred16_t;
+
+typedef struct { int16_t v[8]; } int16x8_t;
+typedef struct { int32_t v[4]; } int32x4_t;
+
+/* Lane i of a 16-bit vector is active */
+#define MVE_P16(p, i)  ((((p) >> (2 * (i))) & 1U) != 0U)
+/* Lane i of a 32-bit vector is active */
+#define MVE_P32(p, i)  ((((p) >> (4 * (i))) & 1U) != 0U)
+
+/* Predicates */
+
+static inline mve_pred16_t vctp16q(uint32_t n) {
+  mve_pred16_t p = 0U;
+  for (uint32_t i = 0U; (i < 8U) && (i < n); ++i) {
+    p |= (mve_pred16_t)(3U << (2U * i));
+  }
+  return p;
+}
+
+static inline mve_pred16_t vctp32q(uint32_t n) {
+  mve_pred16_t p = 0U;
+  for (uint32_t i = 0U; (i < 4U) && (i < n); ++i) {
+    p |= (mve_pred16_t)(0xFU << (4U * i));
+  }
+  return p;
+}
+
+/* Duplicate */
+
+static inline int16x8_t vdupq_n_s16(int16_t a) {
+  int16x8_t r;
+  for (int i = 0; i < 8; ++i) {
+    r.v[i] = a;
+  }
+  return r;
+}
+
+static inline int32x4_t vdupq_n_s32(int32_t a) {
+  int32x4_t r;
+  for (int i = 0; i < 4; ++i) {
+    r.v[i] = a;
+  }
+  return r;
+}
+
+/* Loads and stores */
+
+static inline int16x8_t vldrhq_z_s16(const int16_t *base, mve_pred16_t p) {
+  int16x8_t r;
+  for (int i = 0; i < 8; ++i) {
+    r.v[i] = MVE_P16(p, i) ? base[i] : 0;
+  }
+  return r;
+}
+
+static inline void vstrhq_p_s32(int16_t *base, int32x4_t a, mve_pred16_t p) {
+  for (int i = 0; i < 4; ++i) {
+    if (MVE_P32(p, i)) {
+      base[i] = (int16_t)a.v[i];
+    }
+  }
+}
+
+/* Reductions */
+
+static inline int32_t vaddvaq_p_s16(int32_t a, int16x8_t b, mve_pred16_t p) {
+  for (int i = 0; i < 8; ++i) {
+    if (MVE_P16(p, i)) {
+      a += b.v[i];
+    }
+  }
+  return a;
+}
+
+static inline int16_t vminvq_s16(int16_t a, int16x8_t b) {
+  for (int i = 0; i < 8; ++i) {
+    a = (b.v[i] < a) ? b.v[i] : a;
+  }
+  return a;
+}
+
+static inline int16_t vmaxvq_s16(int16_t a, int16x8_t b) {
+  for (int i = 0; i < 8; ++i) {
+    a = (b.v[i] > a) ? b.v[i] : a;
+  }
+  return a;
+}
+
+/* Minimum and maximum */
+
+static inline int16x8_t vminq_m_s16(int16x8_t inactive, int16x8_t a, int16x8_t b, mve_pred16_t p) {
+  for (int i = 0; i < 8; ++i) {
+    if (MVE_P16(p, i)) {
+      inactive.v[i] = (a.v[i] < b.v[i]) ? a.v[i] : b.v[i];
+    }
+  }
+  return inactive;
+}
+
+static inline int16x8_t vmaxq_m_s16(int16x8_t inactive, int16x8_t a, int16x8_t b, mve_pred16_t p) {
+  for (int i = 0; i < 8; ++i) {
+    if (MVE_P16(p, i)) {
+      inactive.v[i] = (a.v[i] > b.v[i]) ? a.v[i] : b.v[i];
+    }
+  }
+  return inactive;
+}
+
+static inline int32x4_t vminq_s32(int32x4_t a, int32x4_t b) {
+  for (int i = 0; i < 4; ++i) {
+    a.v[i] = (a.v[i] < b.v[i]) ? a.v[i] : b.v[i];
+  }
+  return a;
+}
+
+static inline int32x4_t vmaxq_s32(int32x4_t a, int32x4_t b) {
+  for (int i = 0; i < 4; ++i) {
+    a.v[i] = (a.v[i] > b.v[i]) ? a.v[i] : b.v[i];
+  }
+  return a;
+}
+
+/* Widening */
+
+static inline int32x4_t vmovlbq_s16(int16x8_t a) {
+  int32x4_t r;
+  for (int i = 0; i < 4; ++i) {
+    r.v[i] = a.v[2 * i];
+  }
+  return r;
+}
+
+static inline int32x4_t vmovltq_s16(int16x8_t a) {
+  int32x4_t r;
+  for (int i = 0; i < 4; ++i) {
+    r.v[i] = a.v[2 * i + 1];
+  }
+  return r;
+}
+
+/* Arithmetic, wrapping like the target */
+
+static inline int32x4_t vaddq_s32(int32x4_t a, int32x4_t b) {
+  for (int i = 0; i < 4; ++i) {
+    a.v[i] = (int32_t)((uint32_t)a.v[i] + (uint32_t)b.v[i]);
+  }
+  return a;
+}
+
+static inline int32x4_t vaddq_n_s32(int32x4_t a, int32_t b) {
+  for (int i = 0; i < 4; ++i) {
+    a.v[i] = (int32_t)((uint32_t)a.v[i] + (uint32_t)b);
+  }
+  return a;
+}
+
+static inline int32x4_t vmulq_n_s32(int32x4_t a, int32_t b) {
+  for (int i = 0; i < 4; ++i) {
+    a.v[i] = (int32_t)((uint32_t)a.v[i] * (uint32_t)b);
+  }
+  return a;
+}
+
+static inline int32x4_t vshrq_n_s32(int32x4_t a, int imm) {
+  for (int i = 0; i < 4; ++i) {
+    a.v[i] >>= imm;
+  }
+  return a;
+}
+
+#endif /* ARM_MVE_HOST_H */
@@ -0,0 +1,172 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Equivalence test of the live audio conditioning.
+
+  The previous five pass path (see audio_conditioning_ref.h) is compared
+  with the fused scalar and Helium kernels. The offset, the scale and the
+  mono samples must be bit-exact, and the fused kernels must leave the
+  stereo block unmodified. Checked signals are random full range blocks,
+  quiet noise, DC-shifted noise, constant blocks and full scale blocks,
+  with short block lengths for the vector tails and the live 500 ms block.
+*/
+
+#include <string.h>
+
+#include "audio_processing_func.h"
+#include "audio_processing_func_mve_host.h"
+#include "audio_conditioning_ref.h"
+#include "test_common.h"
+
+/* Stereo frames of the live 500 ms block at 16 kHz */
+#define LIVE_BLOCK_FRAMES   8000U
+
+/* Test signals */
+typedef enum {
+  SIGNAL_RANDOM = 0,    /* Random full range samples */
+  SIGNAL_QUIET,         /* Low level noise, gets the maximum scale */
+  SIGNAL_DC_SHIFTED,    /* Noise around a large DC level, clipped by the scale */
+  SIGNAL_CONSTANT,      /* Constant samples, a zero span */
+  SIGNAL_FULL_SCALE,    /* Random INT16_MIN and INT16_MAX samples */
+  SIGNAL_COUNT
+} test_signal_t;
+
+static const char *const signal_name[SIGNAL_COUNT] = {
+  "random", "quiet", "dc-shifted", "constant", "full-scale"
+};
+
+static int16_t saturate(int32_t val) {
+  return (int16_t)((val < INT16_MIN) ? INT16_MIN : (val > INT16_MAX) ? INT16_MAX : val);
+}
+
+/*
+  Generate a stereo test block.
+
+  \param[out]    stereo   Pointer to the interleaved stereo samples.
+  \param[in]     samples  Number of samples.
+  \param[in]     signal   Test signal.
+  \param[in,out] seed     Generator state.
+*/
+static void generate(int16_t *stereo, uint32_t samples, test_signal_t signal, uint32_t *seed) {
+  const int32_t level = (int32_t)(test_rand(seed) % 40001U) - 20000;
+  const int32_t noise = (int32_t)(test_rand(seed) % 2000U) + 1;
+  const int16_t value = (int16_t)(test_rand(seed) >> 16);
+
+  for (uint32_t i = 0; i < samples; ++i) {
+    const uint32_t r = test_rand(seed);
+
+    switch (signal) {
+      case SIGNAL_RANDOM:
+        stereo[i] = (int16_t)(r >> 16);
+        break;
+      case SIGNAL_QUIET:
+        stereo[i] = (int16_t)((int32_t)(r % 601U) - 300);
+        break;
+      case SIGNAL_DC_SHIFTED:
+        stereo[i] = saturate(level + (int32_t)(r % (2U * (uint32_t)noise + 1U)) - noise);
+        break;
+      case SIGNAL_CONSTANT:
+        stereo[i] = value;
+        break;
+      default:
+        stereo[i] = ((r >> 31) != 0U) ? INT16_MAX : INT16_MIN;
+        break;
+    }
+  }
+}
+
+/*
+  Condition a block with the previous path and the fused kernels and
+  compare the results.
+
+  \return  Number of checked cases.
+*/
+static int check_block(const char *name, const int16_t *stereo, uint32_t frames,
+                       int16_t *work, int16_t *expected, int16_t *actual) {
+  const uint32_t samples = frames * 2U;
+  audio_conditioning_t ref;
+  audio_conditioning_t res;
+  char case_name[128];
+  int checks = 0;
+
+  memcpy(work, stereo, samples * sizeof(int16_t));
+  ref_condition_block(work, expected, frames, &ref);
+
+  for (int mve = 0; mve <= 1; ++mve) {
+    snprintf(case_name, sizeof(case_name), "%s %s", mve ? "mve" : "scalar", name);
+
+    memcpy(work, stereo, samples * sizeof(int16_t));
+    memset(actual, 0x5A, frames * sizeof(int16_t));
+    if (mve) {
+      fused_condition_block(work, actual, frames, &res, mve_audio_block_stats, mve_audio_condition_to_mono);
+    } else {
+      fused_condition_block(work, actual, frames, &res, audio_block_stats, audio_condition_to_mono);
+    }
+
+    test_check_value(case_name, "offset", ref.offset, res.offset);
+    test_check_value(case_name, "scale", ref.scale, res.scale);
+    test_check_samples(case_name, expected, actual, frames);
+    test_check_samples(case_name, stereo, work, samples);
+    checks += 4;
+  }
+  return checks;
+}
+
+int main(void) {
+  int16_t *stereo   = test_alloc(LIVE_BLOCK_FRAMES * 2U * sizeof(int16_t));
+  int16_t *work     = test_alloc(LIVE_BLOCK_FRAMES * 2U * sizeof(int16_t));
+  int16_t *expected = test_alloc(LIVE_BLOCK_FRAMES * sizeof(int16_t));
+  int16_t *actual   = test_alloc(LIVE_BLOCK_FRAMES * sizeof(int16_t));
+  uint32_t seed = 0x2468ACE1U;
+  char name[96];
+  int checks = 0;
+
+  for (test_signal_t signal = SIGNAL_RANDOM; signal < SIGNAL_COUNT; ++signal) {
+    /* Short blocks, every vector tail length */
+    for (uint32_t frames = 1U; frames <= 33U; ++frames) {
+      for (int n = 0; n < 8; ++n) {
+        generate(stereo, frames * 2U, signal, &seed);
+        snprintf(name, sizeof(name), "%s %u frames", signal_name[signal], (unsigned)frames);
+        checks += check_block(name, stereo, frames, work, expected, actual);
+      }
+    }
+
+    /* Random block lengths */
+    for (int n = 0; n < 20; ++n) {
+      const uint32_t frames = 1U + (test_rand(&seed) % LIVE_BLOCK_FRAMES);
+      generate(stereo, frames * 2U, signal, &seed);
+      snprintf(name, sizeof(name), "%s %u frames", signal_name[signal], (unsigned)frames);
+      checks += check_block(name, stereo, frames, work, expected, actual);
+    }
+
+    /* Live block */
+    for (int n = 0; n < 20; ++n) {
+      generate(stereo, LIVE_BLOCK_FRAMES * 2U, signal, &seed);
+      snprintf(name, sizeof(name), "%s live block", signal_name[signal]);
+      checks += check_block(name, stereo, LIVE_BLOCK_FRAMES, work, expected, actual);
+    }
+  }
+
+  free(stereo);
+  free(work);
+  free(expected);
+  free(actual);
+
+  return test_report("audio_conditioning", checks);
+}
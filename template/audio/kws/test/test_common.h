@@ -0,0 +1,118 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Helpers shared by the audio processing host tests.
+*/
+
+#ifndef TEST_COMMON_H__
+#define TEST_COMMON_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Number of failed checks */
+static int test_failures = 0;
+
+/*
+  Get next value of a deterministic pseudo-random sequence.
+
+  \param[in,out] state  Generator state.
+  \return               Pseudo-random 32-bit value.
+*/
+static inline uint32_t test_rand(uint32_t *state) {
+  /* xorshift32 */
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+/*
+  Allocate a buffer, exit the test on failure.
+
+  \param[in] size  Size of the buffer in bytes.
+  \return          Pointer to the buffer.
+*/
+static inline void *test_alloc(size_t size) {
+  void *buf = malloc((size != 0U) ? size : 1U);
+  if (buf == NULL) {
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+  }
+  return buf;
+}
+
+/*
+  Compare two values and report a difference.
+
+  \param[in] name      Name of the checked case.
+  \param[in] what      Name of the checked value.
+  \param[in] expected  Expected value.
+  \param[in] actual    Actual value.
+  \return              1 if the values are equal, otherwise 0.
+*/
+static inline int test_check_value(const char *name, const char *what, int32_t expected, int32_t actual) {
+  if (expected != actual) {
+    fprintf(stderr, "FAIL %s: %s is %d, expected %d\n", name, what, (int)actual, (int)expected);
+    test_failures++;
+    return 0;
+  }
+  return 1;
+}
+
+/*
+  Compare two sample buffers and report the first difference.
+
+  \param[in] name      Name of the checked case.
+  \param[in] expected  Pointer to the expected samples.
+  \param[in] actual    Pointer to the actual samples.
+  \param[in] count     Number of samples.
+  \return              1 if the buffers are equal, otherwise 0.
+*/
+static inline int test_check_samples(const char *name, const int16_t *expected, const int16_t *actual, uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i) {
+    if (expected[i] != actual[i]) {
+      fprintf(stderr, "FAIL %s: sample %u is %d, expected %d\n", name, (unsigned)i, actual[i], expected[i]);
+      test_failures++;
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*
+  Report the test result.
+
+  \param[in] test    Name of the test.
+  \param[in] checks  Number of checked cases.
+  \return            Exit code of the test program.
+*/
+static inline int test_report(const char *test, int checks) {
+  if (test_failures != 0) {
+    printf("%s: %d of %d checks failed\n", test, test_failures, checks);
+    return 1;
+  }
+  printf("%s: %d checks passed\n", test, checks);
+  return 0;
+}
+
+#endif /* TEST_COMMON_H__ */
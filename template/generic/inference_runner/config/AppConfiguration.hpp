@@ -60,4 +60,26 @@
 
 // </h>
 
+// <h>Heap Monitor Configuration
+// ===================================
+
+//  <q>Heap Monitor
+//  <i> Count heap allocations made after the application initialisation is
+//  <i> complete and report them after the inference, which is expected to run
+//  <i> without allocating.
+//  <i> Default: 0
+#ifndef APP_HEAP_MONITOR
+#define APP_HEAP_MONITOR            0
+#endif
+
+//  <q>Break on Allocation
+//  <i> Execute a breakpoint instruction on the first counted allocation, so the
+//  <i> debugger shows its call stack. Without a debugger the application stops.
+//  <i> Default: 0
+#ifndef APP_HEAP_MONITOR_BREAK
+#define APP_HEAP_MONITOR_BREAK      0
+#endif
+
+// </h>
+
 #endif /* APP_CONFIGURATION_HPP */
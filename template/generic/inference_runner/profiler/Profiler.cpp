@@ -17,6 +17,7 @@
 #include "Profiler.hpp"
 #include "log_macros.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace arm {
@@ -26,8 +27,9 @@ namespace app {
     {}
 
     Profiler::Profiler(const char* name)
-        : m_name(name)
-    {}
+    {
+        this->SetName(name);
+    }
 
     bool Profiler::StartProfiling(const char* name)
     {
@@ -40,17 +42,22 @@ namespace app {
             this->m_tstampSt.initialised = false;
             hal_pmu_get_counters(&this->m_tstampSt);
             if (this->m_tstampSt.initialised) {
-                if (this->m_profStats.count(this->m_name) == 0) {
-                    this->m_profStats.insert(
-                            std::pair<std::string, std::vector<Statistics>>(
-                                    this->m_name, std::vector<Statistics>(this->m_tstampSt.num_counters))
-                                    );
+                if (this->FindSeries(this->m_name) == nullptr) {
+                    if (this->m_numSeries == PROFILER_MAX_SERIES) {
+                        printf_err("Too many profiling series for %s\n", this->m_name);
+                        return false;
+                    }
+                    ProfilingSeries& series = this->m_series[this->m_numSeries++];
+                    series = ProfilingSeries{};
+                    strcpy(series.name, this->m_name);
+                    series.numStats = std::min<std::uint32_t>(this->m_tstampSt.num_counters,
+                                                              NUM_PMU_COUNTERS);
                 }
                 this->m_started = true;
                 return true;
             }
         }
-        printf_err("Failed to start profiler %s\n", this->m_name.c_str());
+        printf_err("Failed to start profiler %s\n", this->m_name);
         return false;
     }
 
@@ -68,7 +75,7 @@ namespace app {
                 return true;
             }
         }
-        printf_err("Failed to stop profiler %s\n", this->m_name.c_str());
+        printf_err("Failed to stop profiler %s\n", this->m_name);
         return false;
     }
 
@@ -78,14 +85,14 @@ namespace app {
             this->Reset();
             return true;
         }
-        printf_err("Failed to stop profiler %s\n", this->m_name.c_str());
+        printf_err("Failed to stop profiler %s\n", this->m_name);
         return false;
     }
 
     void Profiler::Reset()
     {
         this->m_started = false;
-        this->m_profStats.clear();
+        this->m_numSeries = 0;
         memset(&this->m_tstampSt, 0, sizeof(this->m_tstampSt));
         memset(&this->m_tstampEnd, 0, sizeof(this->m_tstampEnd));
     }
@@ -101,15 +108,14 @@ namespace app {
 
     void Profiler::GetAllResultsAndReset(std::vector<ProfileResult>& results)
     {
-        for (const auto& item: this->m_profStats) {
-            auto name = item.first;
-            std::vector<Statistics> series = item.second;
+        for (std::uint32_t s = 0; s < this->m_numSeries; ++s) {
+            const ProfilingSeries& series = this->m_series[s];
             ProfileResult result{};
-            result.name = item.first;
+            result.name = series.name;
 
-            for (Statistics& stat : series) {
-                result.samplesNum = stat.samplesNum;
-                result.data.emplace_back(stat);
+            for (std::uint32_t i = 0; i < series.numStats; ++i) {
+                result.samplesNum = series.stats[i].samplesNum;
+                result.data.emplace_back(series.stats[i]);
             }
 
             results.emplace_back(result);
@@ -124,35 +130,49 @@ namespace app {
     }
 
     void Profiler::PrintProfilingResult(bool printFullStat) {
-        std::vector<ProfileResult> results{};
-        GetAllResultsAndReset(results);
-        for(ProfileResult& result: results) {
-            if (!result.data.empty()) {
-                info("Profile for %s:\n", result.name.c_str());
+        /* Printed from the series storage, without collecting the results. */
+        for (std::uint32_t s = 0; s < this->m_numSeries; ++s) {
+            const ProfilingSeries& series = this->m_series[s];
+            if (series.numStats != 0) {
+                info("Profile for %s:\n", series.name);
                 if (printFullStat) {
-                    printStatisticsHeader(result.samplesNum);
+                    printStatisticsHeader(series.stats[0].samplesNum);
                 }
             }
 
-            for (Statistics &stat: result.data) {
+            for (std::uint32_t i = 0; i < series.numStats; ++i) {
+                const Statistics& stat = series.stats[i];
                 if (printFullStat) {
                     info("%s %s: %" PRIu64 "/ %.0f / %" PRIu64 " / %" PRIu64 " \n",
-                         stat.name.c_str(), stat.unit.c_str(),
+                         stat.name, stat.unit,
                          stat.total, stat.avrg, stat.min, stat.max);
                 } else {
-                    info("%s: %.0f %s\n", stat.name.c_str(), stat.avrg, stat.unit.c_str());
+                    info("%s: %.0f %s\n", stat.name, stat.avrg, stat.unit);
                 }
             }
         }
+
+        this->Reset();
     }
 
     void Profiler::SetName(const char* str)
     {
-        this->m_name = std::string(str);
+        strncpy(this->m_name, str, sizeof(this->m_name) - 1);
+        this->m_name[sizeof(this->m_name) - 1] = '\0';
+    }
+
+    ProfilingSeries* Profiler::FindSeries(const char* name)
+    {
+        for (std::uint32_t s = 0; s < this->m_numSeries; ++s) {
+            if (strcmp(this->m_series[s].name, name) == 0) {
+                return &this->m_series[s];
+            }
+        }
+        return nullptr;
     }
 
     void Profiler::UpdateRunningStats(pmu_counters start, pmu_counters end,
-                                      const std::string& name)
+                                      const char* name)
     {
         struct ProfilingUnit unit = {
             .counters = end
@@ -173,21 +193,19 @@ namespace app {
             }
         }
 
-        for (size_t i = 0; i < this->m_profStats[name].size(); ++i) {
-            this->m_profStats[name][i].name = unit.counters.counters[i].name;
-            this->m_profStats[name][i].unit = unit.counters.counters[i].unit;
-            ++this->m_profStats[name][i].samplesNum;
-            calcProfilingStat(
-                    unit.counters.counters[i].value,
-                    this->m_profStats[name][i]);
+        ProfilingSeries* series = this->FindSeries(name);
+        if (series == nullptr) {
+            printf_err("Unknown profiling series %s\n", name);
+            return;
         }
 
-        ProfileResult result{};
-        result.name = this->m_name;
-        result.samplesNum = this->m_profStats[name][0].samplesNum;
-
-        for (Statistics& stat : this->m_profStats[name]) {
-            result.data.emplace_back(stat);
+        for (size_t i = 0; i < series->numStats; ++i) {
+            series->stats[i].name = unit.counters.counters[i].name;
+            series->stats[i].unit = unit.counters.counters[i].unit;
+            ++series->stats[i].samplesNum;
+            calcProfilingStat(
+                    unit.counters.counters[i].value,
+                    series->stats[i]);
         }
     }
 
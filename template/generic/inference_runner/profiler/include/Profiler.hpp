@@ -23,16 +23,21 @@ extern "C" {
 
 #include <cstdint>
 #include <string>
-#include <map>
 #include <vector>
 
 namespace arm {
 namespace app {
 
+    /** Maximum number of profiling series recorded by a profiler. */
+    constexpr std::uint32_t PROFILER_MAX_SERIES = 8;
+
+    /** Maximum length of a profiling series name, including the terminator. */
+    constexpr std::uint32_t PROFILER_NAME_LEN = 32;
+
     /** Statistics for a profiling metric. */
     struct Statistics {
-        std::string name;
-        std::string unit;
+        const char* name;
+        const char* unit;
         std::uint64_t total;
         double avrg;
         std::uint64_t min;
@@ -52,8 +57,13 @@ namespace app {
         pmu_counters counters;
     };
 
-    /* A map for string identifiable profiling statistics. */
-    using ProfilingStats = std::map<std::string, std::vector<Statistics>>;
+    /** Statistics of a name identifiable profiling series, in fixed storage
+     *  so that profiling does not allocate. */
+    struct ProfilingSeries {
+        char name[PROFILER_NAME_LEN];
+        std::uint32_t numStats;
+        Statistics stats[NUM_PMU_COUNTERS];
+    };
 
     /**
      * @brief   A very simple profiler example using the platform timer
@@ -100,11 +110,19 @@ namespace app {
         void SetName(const char* str);
 
     private:
-        ProfilingStats     m_profStats;             /* Profiling stats map. */
+        ProfilingSeries    m_series[PROFILER_MAX_SERIES]{}; /* Profiling stats series. */
+        std::uint32_t      m_numSeries = 0;         /* Number of used series. */
         pmu_counters       m_tstampSt{};            /* Container for a current starting timestamp. */
         pmu_counters       m_tstampEnd{};           /* Container for a current ending timestamp. */
         bool               m_started = false;       /* Indicates profiler has been started. */
-        std::string        m_name;                  /* Name given to this profiler. */
+        char               m_name[PROFILER_NAME_LEN]{}; /* Name given to this profiler. */
+
+        /**
+         * @brief       Finds the profiling series with the name provided.
+         * @param[in]   name    Name of the profiling series.
+         * @return      Pointer to the series, nullptr if it is not found.
+         **/
+        ProfilingSeries* FindSeries(const char* name);
 
 
         /**
@@ -117,7 +135,7 @@ namespace app {
          *                      updated.
          **/
         void UpdateRunningStats(pmu_counters start, pmu_counters end,
-                                const std::string& name);
+                                const char* name);
     };
 
 } /* namespace app */
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HeapMonitor.hpp"
+#include "AppConfiguration.hpp"
+
+#if (APP_HEAP_MONITOR != 0)
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+/* Allocations are counted after the initialisation is complete */
+static volatile bool     Heap_Monitor_Active = false;
+
+/* Allocations counted, size of the last one and allocations already reported */
+static volatile uint32_t Heap_Alloc_Count    = 0U;
+static volatile uint32_t Heap_Alloc_Size     = 0U;
+static uint32_t          Heap_Alloc_Reported = 0U;
+
+/*
+  Record a heap allocation.
+
+  Called from within the allocator, so it must not allocate nor print.
+
+  \param[in]  size  Size of the allocation in bytes.
+*/
+static void heap_monitor_record(size_t size)
+{
+    if (Heap_Monitor_Active) {
+        Heap_Alloc_Count = Heap_Alloc_Count + 1U;
+        Heap_Alloc_Size  = static_cast<uint32_t>(size);
+#if (APP_HEAP_MONITOR_BREAK != 0)
+        /* Stop here, the debugger shows the call stack of the allocation */
+        __BKPT(0);
+#endif
+    }
+}
+
+#if defined(__ARMCC_VERSION)
+/* Arm Compiler: the C library malloc is patched, operator new allocates through it */
+extern "C" void *$Super$$malloc(size_t size);
+
+extern "C" void *$Sub$$malloc(size_t size)
+{
+    heap_monitor_record(size);
+    return $Super$$malloc(size);
+}
+#else
+/* GCC and LLVM: the linker redirects all malloc calls, including the ones from
+   the libraries, to __wrap_malloc (-Wl,--wrap=malloc in the cproject) */
+extern "C" void *__real_malloc(size_t size);
+
+extern "C" void *__wrap_malloc(size_t size)
+{
+    heap_monitor_record(size);
+    return __real_malloc(size);
+}
+
+/* operator new allocates through the counted malloc. Without exceptions an
+   allocation failure cannot be reported to the caller, so it stops here. */
+void *operator new(std::size_t size)
+{
+    void *ptr = std::malloc((size != 0U) ? size : 1U);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+    void *ptr = std::malloc((size != 0U) ? size : 1U);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t size) noexcept
+{
+    (void)size;
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t size) noexcept
+{
+    (void)size;
+    std::free(ptr);
+}
+#endif
+
+void heap_monitor_start(void)
+{
+    Heap_Alloc_Count    = 0U;
+    Heap_Alloc_Reported = 0U;
+    Heap_Monitor_Active = true;
+}
+
+uint32_t heap_monitor_get_count(void)
+{
+    return Heap_Alloc_Count;
+}
+
+bool heap_monitor_check(const char *where)
+{
+    /* Count is read once, printing may allocate */
+    const uint32_t count = Heap_Alloc_Count;
+    const uint32_t size  = Heap_Alloc_Size;
+
+    if (count == Heap_Alloc_Reported) {
+        return true;
+    }
+
+    printf("Heap monitor: %" PRIu32 " allocation(s) in %s, last of %" PRIu32 " bytes\n",
+           count - Heap_Alloc_Reported, where, size);
+    Heap_Alloc_Reported = count;
+    return false;
+}
+
+#else /* APP_HEAP_MONITOR != 0 */
+
+#if !defined(__ARMCC_VERSION)
+#include <cstddef>
+
+/* GCC and LLVM: malloc is always redirected here by the link options, pass it on */
+extern "C" void *__real_malloc(size_t size);
+
+extern "C" void *__wrap_malloc(size_t size)
+{
+    return __real_malloc(size);
+}
+#endif
+
+void heap_monitor_start(void)
+{
+}
+
+uint32_t heap_monitor_get_count(void)
+{
+    return 0U;
+}
+
+bool heap_monitor_check(const char *where)
+{
+    (void)where;
+    return true;
+}
+
+#endif /* APP_HEAP_MONITOR != 0 */
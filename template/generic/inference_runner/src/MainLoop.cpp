@@ -22,6 +22,7 @@
 #include "main.h"
 #include "log_macros.h"             /* Logging functions */
 #include "BufAttributes.hpp"        /* Buffer attributes to be applied */
+#include "HeapMonitor.hpp"          /* Heap allocation monitor */
 
 #include "cmsis_os2.h"                /* ::CMSIS:RTOS2 */
 
@@ -77,12 +78,17 @@ void app_main_thread(void *arg)
     caseContext.Set<arm::app::Profiler&>("profiler", profiler);
     caseContext.Set<arm::app::Model&>("model", model);
 
+    /* Initialisation is complete, the inference is expected not to allocate. */
+    heap_monitor_start();
+
     /* Loop. */
     if (RunInferenceHandler(caseContext)) {
         info("Inference completed.\n");
     } else {
         printf_err("Inference failed.\n");
     }
+
+    heap_monitor_check("inference");
 }
 
 /* Application initialization */
@@ -41,13 +41,6 @@ namespace app {
         info("Total number of inferences: 1\n");
 
         for (uint32_t i = 0; i < results.size(); ++i) {
-            std::string resultStr = std::to_string(i + 1) + ") " +
-                                    std::to_string(results[i].m_labelIdx) + " (" +
-                                    std::to_string(results[i].m_normalisedVal) + ")";
-
-
-
-            resultStr = std::to_string(i + 1) + ") " + results[i].m_label;
             rowIdx2 += dataPsnTxtYIncr;
 
             info("%" PRIu32 ") %" PRIu32 " (%f) -> %s\n",
@@ -80,20 +73,16 @@ namespace app {
 #if VERIFY_TEST_OUTPUT
     void DumpTensorData(const uint8_t* tensorData, size_t size, size_t lineBreakForNumElements)
     {
-        char strhex[8];
-        std::string strdump;
-
+        /* Elements are printed as they are formatted, without building the line. */
         for (size_t i = 0; i < size; ++i) {
             if (0 == i % lineBreakForNumElements) {
-                printf("%s\n\t", strdump.c_str());
-                strdump.clear();
+                printf("\n\t");
             }
-            snprintf(strhex, sizeof(strhex) - 1, "0x%02x, ", tensorData[i]);
-            strdump += std::string(strhex);
+            printf("0x%02x, ", tensorData[i]);
         }
 
-        if (!strdump.empty()) {
-            printf("%s\n", strdump.c_str());
+        if (size != 0) {
+            printf("\n");
         }
     }
 
@@ -138,11 +138,8 @@ bool RunInferenceHandler(ApplicationContext& ctx)
     DumpInputs(model, "input tensors populated");
 #endif /* VERIFY_TEST_OUTPUT */
 
-    /* Strings for presentation/logging. */
-    std::string str_inf{"Running inference... "};
-
     /* Display message on the LCD - inference running. */
-    // mhtodo hal_lcd_display_text(str_inf.c_str(), str_inf.size(),
+    // mhtodo hal_lcd_display_text("Running inference... ", 21,
     //                     dataPsnTxtInfStartX, dataPsnTxtInfStartY, 0);
 
     if (!RunInference(model, profiler)) {
@@ -150,9 +147,8 @@ bool RunInferenceHandler(ApplicationContext& ctx)
     }
 
     /* Erase. */
-    str_inf = std::string(str_inf.size(), ' ');
     // mhtodo hal_lcd_display_text(
-    //                        str_inf.c_str(), str_inf.size(),
+    //                        "                     ", 21,
     //                        dataPsnTxtInfStartX, dataPsnTxtInfStartY, 0);
 
     info("Final results:\n");
@@ -60,4 +60,132 @@
 
 // </h>
 
+// <h>Pipeline Configuration
+// ===================================
+
+//  <q>Pipelined Processing
+//  <i> Run capture, inference and display in separate threads, so that
+//  <i> capture and display of neighbouring images overlap the inference.
+//  <i> Default: 0 (sequential processing)
+#ifndef APP_PIPELINE
+#define APP_PIPELINE                0
+#endif
+
+//  <o>Pipeline Frame Slots <2-4>
+//  <i> Define the number of images in flight between the pipeline stages.
+//  <i> Each slot holds an ML image and a copy of the model output.
+//  <i> Default: 3
+#ifndef APP_PIPELINE_SLOTS
+#define APP_PIPELINE_SLOTS          3
+#endif
+
+//  <o>Pipeline Output Buffer Size
+//  <i> Define the size in bytes of the model output copy in each slot.
+//  <i> Default: 4096
+#ifndef APP_PIPELINE_OUTPUT_BUF_SZ
+#define APP_PIPELINE_OUTPUT_BUF_SZ  4096
+#endif
+
+//  <o>Pipeline Statistics Interval
+//  <i> Define the number of images between pipeline timing reports (0 disables reports).
+//  <i> Default: 32
+#ifndef APP_PIPELINE_STATS_INTERVAL
+#define APP_PIPELINE_STATS_INTERVAL 32
+#endif
+
+// </h>
+
+// <h>Tracker Configuration
+// ===================================
+
+//  <q>Object Tracker
+//  <i> Associate detections across images and assign track identifiers.
+//  <i> Box positions are predicted on images where the detector is not run.
+//  <i> Default: 0
+#ifndef APP_TRACKER
+#define APP_TRACKER                 0
+#endif
+
+//  <o>Detection Interval <1-30>
+//  <i> Define how often the detector is run: every Nth image, the tracker
+//  <i> predicts the boxes of the images in between.
+//  <i> Default: 1 (every image)
+#ifndef APP_TRACKER_DETECT_INTERVAL
+#define APP_TRACKER_DETECT_INTERVAL 1
+#endif
+
+//  <o>Maximum Tracks <1-32>
+//  <i> Define the maximum number of objects tracked at the same time.
+//  <i> Default: 8
+#ifndef APP_TRACKER_MAX_TRACKS
+#define APP_TRACKER_MAX_TRACKS      8
+#endif
+
+//  <o>IoU Threshold [%] <1-100>
+//  <i> Define the minimum intersection over union of a predicted track box and
+//  <i> a detection box for them to be associated.
+//  <i> Default: 30
+#ifndef APP_TRACKER_IOU_THRESHOLD
+#define APP_TRACKER_IOU_THRESHOLD   30
+#endif
+
+//  <o>Maximum Missed Detections
+//  <i> Define the number of detector runs a track is kept without a matching detection.
+//  <i> Default: 2
+#ifndef APP_TRACKER_MAX_MISSES
+#define APP_TRACKER_MAX_MISSES      2
+#endif
+
+// </h>
+
+// <h>Profiling Configuration
+// ===================================
+
+//  <q>Stage Profiling
+//  <i> Measure the time of the application stages (prepare frame, pre-processing,
+//  <i> inference, post-processing and display) with the cycle counter and print
+//  <i> their min/avg/max/p95 periodically. Not used by the pipelined application.
+//  <i> Default: 0
+#ifndef APP_PROFILE
+#define APP_PROFILE                 0
+#endif
+
+//  <o>Statistics Window <8-256>
+//  <i> Define the number of most recent samples per stage the statistics are computed from.
+//  <i> Default: 64
+#ifndef APP_PROFILE_WINDOW
+#define APP_PROFILE_WINDOW          64
+#endif
+
+//  <o>Report Interval
+//  <i> Define the number of images between profiling reports.
+//  <i> Default: 64
+#ifndef APP_PROFILE_INTERVAL
+#define APP_PROFILE_INTERVAL        64
+#endif
+
+// </h>
+
+// <h>Heap Monitor Configuration
+// ===================================
+
+//  <q>Heap Monitor
+//  <i> Count heap allocations made after the application initialisation is
+//  <i> complete and report them from the image loop, which is expected to run
+//  <i> without allocating.
+//  <i> Default: 0
+#ifndef APP_HEAP_MONITOR
+#define APP_HEAP_MONITOR            0
+#endif
+
+//  <q>Break on Allocation
+//  <i> Execute a breakpoint instruction on the first counted allocation, so the
+//  <i> debugger shows its call stack. Without a debugger the application stops.
+//  <i> Default: 0
+#ifndef APP_HEAP_MONITOR_BREAK
+#define APP_HEAP_MONITOR_BREAK      0
+#endif
+
+// </h>
+
 #endif /* APP_CONFIGURATION_HPP */
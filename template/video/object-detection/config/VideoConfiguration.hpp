@@ -40,8 +40,8 @@
 #define CAMERA_FRAME_HEIGHT         720
 #endif
 
-//  <o>Frame Type <0=>RAW8 <1=>RGB565 <2=>RGB888
-//  <i> Define whether camera frame is raw or RGB.
+//  <o>Frame Type <0=>RAW8 <1=>RGB565 <2=>RGB888 <3=>YUV420 <4=>NV12 <5=>NV21
+//  <i> Define whether camera frame is raw, RGB or YUV 4:2:0.
 //  <i> Default: 0
 #ifndef CAMERA_FRAME_TYPE
 #define CAMERA_FRAME_TYPE           0
@@ -68,6 +68,16 @@
 #define CAMERA_FRAME_BUF_ALIGNMENT  32
 #endif
 
+//  <o>Frame Buffer Count <1-3>
+//  <i> Define the number of camera frames in the capture buffer.
+//  <i> 1: every frame is captured on request (single mode).
+//  <i> 2 or 3: camera captures continuously into a frame ring while the
+//  <i> previous frame is processed, the latest captured frame is used.
+//  <i> Default: 2
+#ifndef CAMERA_FRAME_BUF_COUNT
+#define CAMERA_FRAME_BUF_COUNT      2
+#endif
+
 //  <o>RGB Image Width
 //  <i> Define the RGB image width.
 //  <i> Default: 384
@@ -98,6 +108,128 @@
 
 // </h>
 
+// <h>ML Input Configuration
+// ==========================
+
+//  <q>Direct Model Input Conversion
+//  <i> Enable to crop, debayer and scale RAW8 camera frame directly into the model input
+//  <i> tensor in a single pass, instead of using the intermediate RGB image buffer.
+//  <i> Requires RAW8 camera frame type.
+//  <i> Default: 0
+#ifndef ML_INPUT_DIRECT
+#define ML_INPUT_DIRECT             0
+#endif
+
+// </h>
+
+// <h>Motion Gate Configuration
+// ==============================
+
+//  <q>Motion Gated Inference
+//  <i> Enable to skip inference while the scene is static. A luma thumbnail of
+//  <i> each ML image is compared with the thumbnail of the last inferred image,
+//  <i> the previous detection results are reused when they are alike.
+//  <i> Default: 0
+#ifndef MOTION_GATE
+#define MOTION_GATE                 0
+#endif
+
+//  <o>Change Threshold <0-255>
+//  <i> Define the mean absolute luma difference per thumbnail pixel above which
+//  <i> the image is considered changed.
+//  <i> Default: 4
+#ifndef MOTION_GATE_THRESHOLD
+#define MOTION_GATE_THRESHOLD       4
+#endif
+
+//  <o>Maximum Skipped Images
+//  <i> Define the maximum number of consecutive images without inference,
+//  <i> which bounds the latency to detect a slowly appearing object.
+//  <i> Default: 15
+#ifndef MOTION_GATE_MAX_SKIP
+#define MOTION_GATE_MAX_SKIP        15
+#endif
+
+// </h>
+
+// <h>Region of Interest Configuration
+// ===================================
+
+//  <q>Region of Interest Re-inference
+//  <i> Enable to run the model again on the neighbourhood of small detections,
+//  <i> cropped from the camera frame at up to native resolution. Detections of
+//  <i> the crop refine or extend the detections of the full image.
+//  <i> Requires a RAW8 camera frame, not used by the pipelined application.
+//  <i> Default: 0
+#ifndef ROI_REINFER
+#define ROI_REINFER                 0
+#endif
+
+//  <o>Maximum Extra Inferences per Image <1-8>
+//  <i> Define the maximum number of regions of interest inferred per image.
+//  <i> Default: 2
+#ifndef ROI_REINFER_MAX
+#define ROI_REINFER_MAX             2
+#endif
+
+//  <o>Region Margin [%] <0-400>
+//  <i> Define the margin added around a detection box to form its region of
+//  <i> interest, in percent of the box size.
+//  <i> Default: 100
+#ifndef ROI_REINFER_MARGIN
+#define ROI_REINFER_MARGIN          100
+#endif
+
+// </h>
+
+// <h>Frame Rate Governor Configuration
+// ====================================
+
+//  <q>Frame Rate Governor
+//  <i> Enable to pace images to the target frame rate and to scale quality down
+//  <i> when the image time exceeds the latency budget, in order: skip every
+//  <i> other display frame, convert the RGB image crop at ML image resolution
+//  <i> (RAW8 camera frame), skip every other inference. Quality is scaled back
+//  <i> up when the image time is well within the budget.
+//  <i> Not used by the pipelined application.
+//  <i> Default: 0
+#ifndef FRAME_GOVERNOR
+#define FRAME_GOVERNOR              0
+#endif
+
+//  <o>Target Frame Rate [fps] <1-60>
+//  <i> Define the rate at which images are processed.
+//  <i> Default: 10
+#ifndef FRAME_GOVERNOR_FPS
+#define FRAME_GOVERNOR_FPS          10
+#endif
+
+//  <o>Latency Budget [ms] <0-10000>
+//  <i> Define the maximum average processing time of an image.
+//  <i> 0: frame period of the target frame rate.
+//  <i> Default: 0
+#ifndef FRAME_GOVERNOR_BUDGET_MS
+#define FRAME_GOVERNOR_BUDGET_MS    0
+#endif
+
+//  <o>Measurement Window [images] <2-64>
+//  <i> Define the number of images the processing time is averaged over
+//  <i> before the quality is changed.
+//  <i> Default: 8
+#ifndef FRAME_GOVERNOR_WINDOW
+#define FRAME_GOVERNOR_WINDOW       8
+#endif
+
+//  <o>Step Up Threshold [%] <10-90>
+//  <i> Define the average processing time, in percent of the latency budget,
+//  <i> below which the quality is scaled up again.
+//  <i> Default: 60
+#ifndef FRAME_GOVERNOR_STEP_UP
+#define FRAME_GOVERNOR_STEP_UP      60
+#endif
+
+// </h>
+
 // <h>Display Configuration
 // ========================
 
@@ -131,6 +263,29 @@
 #define DISPLAY_FRAME_BUF_ALIGNMENT 32
 #endif
 
+//  <o>Frame Buffer Count <1-2>
+//  <i> Define the number of display frames in the output buffer.
+//  <i> 1: composing of the next frame waits until the display frame is sent.
+//  <i> 2: next frame is composed while the previous frame is sent (double buffering).
+//  <i> Default: 2
+#ifndef DISPLAY_FRAME_BUF_COUNT
+#define DISPLAY_FRAME_BUF_COUNT     2
+#endif
+
+//  <o>Overlay Color
+//  <i> Define the color of the detection boxes as 0xRRGGBB.
+//  <i> Default: 0x00FF00 (green)
+#ifndef DISPLAY_OVERLAY_COLOR
+#define DISPLAY_OVERLAY_COLOR       0x00FF00
+#endif
+
+//  <o>Overlay Line Width <1-8>
+//  <i> Define the line width of the detection boxes in display pixels.
+//  <i> Default: 1
+#ifndef DISPLAY_OVERLAY_LINE_WIDTH
+#define DISPLAY_OVERLAY_LINE_WIDTH  1
+#endif
+
 // </h>
 
 #endif /* VIDEO_CONFIGURATION_HPP */
@@ -79,6 +79,9 @@
 #define CAMERA_FRAME_TYPE_RAW8    0U
 #define CAMERA_FRAME_TYPE_RGB565  1U
 #define CAMERA_FRAME_TYPE_RGB888  2U
+#define CAMERA_FRAME_TYPE_YUV420  3U
+#define CAMERA_FRAME_TYPE_NV12    4U
+#define CAMERA_FRAME_TYPE_NV21    5U
 
 /* Define input image bit depth */
 #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
@@ -87,10 +90,39 @@
 #define CAMERA_FRAME_COLOR_BYTES 2
 #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB888)
 #define CAMERA_FRAME_COLOR_BYTES 3
+#elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_YUV420) || \
+      (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_NV12)   || \
+      (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_NV21)
+#define CAMERA_FRAME_YUV         1
 #else
 #error "Camera frame type not supported, check CAMERA_FRAME_TYPE definition."
 #endif
 
+/* Direct model input conversion is only available for RAW8 camera frames */
+#if (ML_INPUT_DIRECT != 0) && (CAMERA_FRAME_TYPE != CAMERA_FRAME_TYPE_RAW8)
+#error "Direct model input conversion requires RAW8 camera frame, check ML_INPUT_DIRECT definition."
+#endif
+
+/* Regions of interest are cropped from the RAW8 camera frame */
+#if (ROI_REINFER != 0) && (CAMERA_FRAME_TYPE != CAMERA_FRAME_TYPE_RAW8)
+#error "Region of interest re-inference requires RAW8 camera frame, check ROI_REINFER definition."
+#endif
+
+/* Camera frame ring holds one to three frames */
+#if (CAMERA_FRAME_BUF_COUNT < 1) || (CAMERA_FRAME_BUF_COUNT > 3)
+#error "Camera frame buffer count must be 1, 2 or 3, check CAMERA_FRAME_BUF_COUNT definition."
+#endif
+
+/* Display output buffer holds one or two frames */
+#if (DISPLAY_FRAME_BUF_COUNT < 1) || (DISPLAY_FRAME_BUF_COUNT > 2)
+#error "Display frame buffer count must be 1 or 2, check DISPLAY_FRAME_BUF_COUNT definition."
+#endif
+
+/* Pipeline holds two to four frame slots */
+#if (APP_PIPELINE != 0) && ((APP_PIPELINE_SLOTS < 2) || (APP_PIPELINE_SLOTS > 4))
+#error "Pipeline frame slot count must be 2, 3 or 4, check APP_PIPELINE_SLOTS definition."
+#endif
+
 /* Ensure that the RGB image is square and smaller than camera frame */
 #if (RGB_IMAGE_WIDTH != RGB_IMAGE_HEIGHT)   || \
     (RGB_IMAGE_WIDTH > CAMERA_FRAME_WIDTH)  || \
@@ -111,7 +143,13 @@
 
 
 /* Define camera RAW frame size */
+#if defined(CAMERA_FRAME_YUV)
+/* YUV 4:2:0: full resolution luma plane and quarter resolution chroma planes */
+#define CAMERA_FRAME_SIZE      (CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT + \
+                                2 * ((CAMERA_FRAME_WIDTH + 1) / 2) * ((CAMERA_FRAME_HEIGHT + 1) / 2))
+#else
 #define CAMERA_FRAME_SIZE      (CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT * CAMERA_FRAME_COLOR_BYTES)
+#endif
 
 /* Define RGB image size (RGB888) */
 #define RGB_IMAGE_SIZE         (RGB_IMAGE_WIDTH * RGB_IMAGE_HEIGHT * RGB_IMAGE_COLOR_BYTES)
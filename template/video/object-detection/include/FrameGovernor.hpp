@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAME_GOVERNOR_HPP
+#define FRAME_GOVERNOR_HPP
+
+#include <cstdint>
+
+#include "VideoConfiguration.hpp"
+
+/**
+ * @brief   Quality levels of the governor, each level includes the previous ones.
+ */
+enum GovernorLevel {
+    GOVERNOR_FULL_QUALITY = 0,  /* Every image is inferred and displayed */
+    GOVERNOR_SKIP_DISPLAY,      /* Every other image is displayed */
+    GOVERNOR_REDUCE_RESOLUTION, /* RGB image crop is converted at ML image resolution */
+    GOVERNOR_SKIP_INFERENCE,    /* Every other image is inferred */
+    GOVERNOR_LEVEL_COUNT
+};
+
+#if (FRAME_GOVERNOR != 0)
+/**
+ * @brief   Frame rate governor with deadline based quality scaling.
+ *
+ * Paces the images to FRAME_GOVERNOR_FPS and averages their processing time
+ * over FRAME_GOVERNOR_WINDOW images. The quality level is stepped down when
+ * the average exceeds the latency budget and stepped up when it is below
+ * FRAME_GOVERNOR_STEP_UP percent of the budget.
+ */
+class FrameGovernor {
+public:
+    /**
+     * @brief   Constructor.
+     */
+    FrameGovernor();
+
+    /**
+     * @brief   Starts the first image, applies full quality to the image source.
+     */
+    void Start();
+
+    /**
+     * @brief   Ends the current image and starts the next one: measures the
+     *          processing time, adjusts the quality level, waits for the next
+     *          frame period and applies the level to the image source.
+     */
+    void NextImage();
+
+    /**
+     * @brief   Checks whether the detector may run on the current image.
+     * @return  false if the image is skipped to meet the latency budget.
+     */
+    bool InferImage() const;
+
+    /**
+     * @brief   Gets the current quality level.
+     * @return  Quality level.
+     */
+    GovernorLevel GetLevel() const;
+
+private:
+    /**
+     * @brief       Changes the quality level, levels not supported by the
+     *              image source are passed over.
+     * @param[in]   down    true to lower the quality, false to raise it.
+     */
+    void Step(bool down);
+
+    /**
+     * @brief   Applies the per-image settings of the level to the image source.
+     */
+    void Apply();
+
+    GovernorLevel m_level;
+    uint32_t      m_image;      /* Images since start */
+    uint32_t      m_start;      /* Processing start of the current image (system timer) */
+    uint32_t      m_budget;     /* Latency budget (system timer ticks) */
+    uint32_t      m_period;     /* Frame period (kernel ticks) */
+    uint32_t      m_nextTick;   /* Start of the next frame period (kernel ticks) */
+    uint64_t      m_sum;        /* Processing time of the images in the window */
+    uint32_t      m_count;      /* Images in the window */
+    bool          m_canReduce;  /* Image source supports the reduced resolution */
+};
+#else
+/* Governor disabled, every image is inferred and displayed at full quality */
+class FrameGovernor {
+public:
+    void Start() {}
+    void NextImage() {}
+    bool InferImage() const { return true; }
+    GovernorLevel GetLevel() const { return GOVERNOR_FULL_QUALITY; }
+};
+#endif
+
+#endif /* FRAME_GOVERNOR_HPP */
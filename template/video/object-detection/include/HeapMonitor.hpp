@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HEAP_MONITOR_HPP
+#define HEAP_MONITOR_HPP
+
+#include <cstdint>
+
+/*
+ * Heap allocation monitor for the steady state of the application.
+ *
+ * Allocations made after heap_monitor_start() are counted when
+ * APP_HEAP_MONITOR is enabled in AppConfiguration.hpp, otherwise
+ * the functions do nothing.
+ */
+
+/**
+ * @brief   Marks the end of the initialisation, allocations made from
+ *          now on are counted.
+ */
+void heap_monitor_start(void);
+
+/**
+ * @brief   Gets the number of allocations made since heap_monitor_start().
+ * @return  Number of allocations.
+ */
+uint32_t heap_monitor_get_count(void);
+
+/**
+ * @brief       Reports the allocations made since the previous check.
+ * @param[in]   where   Name of the checked code section, used in the report.
+ * @return      true if there was no new allocation, false otherwise.
+ */
+bool heap_monitor_check(const char *where);
+
+#endif /* HEAP_MONITOR_HPP */
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJECT_TRACKER_HPP
+#define OBJECT_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AppConfiguration.hpp"
+#include "DetectionResult.hpp"
+
+/**
+ * @brief   Object followed by the tracker, with a constant velocity motion model.
+ */
+struct TrackedObject {
+    uint32_t id;        /* Track identifier */
+    float    cx;        /* Box center X coordinate */
+    float    cy;        /* Box center Y coordinate */
+    float    w;         /* Box width */
+    float    h;         /* Box height */
+    float    vx;        /* Box center X velocity per image */
+    float    vy;        /* Box center Y velocity per image */
+    uint32_t frames;    /* Images since the last matched detection */
+    uint32_t misses;    /* Consecutive detector runs without a matched detection */
+};
+
+/**
+ * @brief   Multi-object tracker associating detections across images by
+ *          intersection over union (IoU).
+ *
+ * Tracks are kept in a fixed size array, the tracker does not allocate memory.
+ */
+class ObjectTracker {
+public:
+    /**
+     * @brief       Constructor.
+     * @param[in]   imgWidth    Width of the image the boxes refer to.
+     * @param[in]   imgHeight   Height of the image the boxes refer to.
+     */
+    ObjectTracker(uint32_t imgWidth, uint32_t imgHeight);
+
+    /**
+     * @brief   Removes all tracks.
+     */
+    void Reset();
+
+    /**
+     * @brief       Advances the tracks to the current image and associates them
+     *              with the detections of the image. Unmatched detections start
+     *              new tracks, tracks without a detection for too long are removed.
+     * @param[in]   detections  Detection results of the current image.
+     */
+    void Update(const std::vector<arm::app::object_detection::DetectionResult>& detections);
+
+    /**
+     * @brief   Advances the tracks to the current image, when the detector is not run.
+     */
+    void Predict();
+
+    /**
+     * @brief   Gets the number of tracks.
+     * @return  Number of tracks.
+     */
+    size_t GetCount() const;
+
+    /**
+     * @brief       Gets a track.
+     * @param[in]   idx     Track index (less than GetCount()).
+     * @return      Reference to the track.
+     */
+    const TrackedObject& GetTrack(size_t idx) const;
+
+    /**
+     * @brief       Gets the box of a track, clipped to the image.
+     * @param[in]   idx     Track index (less than GetCount()).
+     * @param[out]  x0      Box top-left corner X coordinate.
+     * @param[out]  y0      Box top-left corner Y coordinate.
+     * @param[out]  w       Box width.
+     * @param[out]  h       Box height.
+     */
+    void GetBox(size_t idx, uint32_t& x0, uint32_t& y0, uint32_t& w, uint32_t& h) const;
+
+private:
+    TrackedObject m_tracks[APP_TRACKER_MAX_TRACKS];
+    size_t        m_count;
+    uint32_t      m_nextId;
+    float         m_imgWidth;
+    float         m_imgHeight;
+};
+
+#endif /* OBJECT_TRACKER_HPP */
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STAGE_PROFILER_HPP
+#define STAGE_PROFILER_HPP
+
+#include <cstdint>
+
+#include "AppConfiguration.hpp"
+
+/**
+ * @brief   Application stages, as listed in PerformanceResults.md.
+ */
+enum ProfileStage {
+    PROFILE_PREPARE_FRAME = 0,  /* Capture and convert frame to ML image */
+    PROFILE_PRE_PROCESSING,     /* Model input pre-processing */
+    PROFILE_INFERENCE,          /* Model inference */
+    PROFILE_POST_PROCESSING,    /* Detection post-processing */
+    PROFILE_DISPLAY,            /* Display frame with results */
+    PROFILE_STAGE_COUNT
+};
+
+#if (APP_PROFILE != 0)
+/**
+ * @brief   Measures the time of the application stages with the cycle counter.
+ *
+ * The most recent APP_PROFILE_WINDOW samples of every stage are kept and
+ * their min/avg/max/p95 is printed every APP_PROFILE_INTERVAL images, as a
+ * table with the same columns as PerformanceResults.md.
+ */
+class StageProfiler {
+public:
+    /**
+     * @brief   Constructor, enables the cycle counter.
+     */
+    StageProfiler();
+
+    /**
+     * @brief       Starts measuring a stage.
+     * @param[in]   stage   Application stage.
+     */
+    void Start(ProfileStage stage);
+
+    /**
+     * @brief       Stops measuring a stage and records its time.
+     * @param[in]   stage   Application stage.
+     */
+    void Stop(ProfileStage stage);
+
+    /**
+     * @brief   Marks the end of an image, prints the summary periodically.
+     */
+    void EndImage();
+
+    /**
+     * @brief   Prints min/avg/max/p95 of the recorded samples of every stage.
+     */
+    void PrintSummary() const;
+
+private:
+    uint32_t m_samples[PROFILE_STAGE_COUNT][APP_PROFILE_WINDOW];
+    uint32_t m_count[PROFILE_STAGE_COUNT];
+    uint32_t m_start[PROFILE_STAGE_COUNT];
+    uint32_t m_images;
+};
+#else
+/* Profiling disabled, measurement calls compile to nothing */
+class StageProfiler {
+public:
+    void Start(ProfileStage) {}
+    void Stop(ProfileStage) {}
+    void EndImage() {}
+    void PrintSummary() const {}
+};
+#endif
+
+#endif /* STAGE_PROFILER_HPP */
@@ -31,4 +31,50 @@ void set_img_object_box(const uint32_t idx, const uint32_t x0,
                                             const uint32_t w,
                                             const uint32_t h);
 
+/* Model input: the image source writes each image in its final layout and
+   signedness directly into an application provided buffer, for example the
+   model input tensor, instead of a buffer of its own. get_img_array then
+   returns the provided buffer. Returns false when the buffer is too small or
+   the layout is not supported. */
+enum img_layout_t {
+    IMG_LAYOUT_RGB888    = 0,   /* Interleaved R, G, B bytes per pixel */
+    IMG_LAYOUT_GRAYSCALE = 1    /* One luma byte per pixel */
+};
+bool set_img_input_buffer(void *data, const uint32_t size, const img_layout_t layout, const bool is_signed);
+
+uint32_t get_img_dropped_count(void);
+void set_img_display_enabled(const bool enable);
+bool set_img_resolution_reduced(const bool reduced);
+
+/* Change gate: get_img_changed compares the open image with the last image
+   marked with set_img_inferred, which must be called for the open image
+   before the next image is read. get_img_gate_counts returns the number of
+   inferred images and of images found unchanged. */
+bool get_img_changed(const uint32_t idx);
+void set_img_inferred(const uint32_t idx);
+void get_img_gate_counts(uint32_t *processed, uint32_t *skipped);
+
+/* Pipelined operation: the image is captured into and displayed from an
+   application provided ML image buffer (RGB888), so capture, inference and
+   display of different images can overlap. Boxes are set with
+   set_img_object_box and the display frame is shown by close_img_source. */
+bool read_img_source(const uint32_t idx, uint8_t *dst, const uint32_t size);
+bool open_img_display(const uint32_t idx, const uint8_t *img);
+
+/* Region of interest: the neighbourhood of a box (ML image coordinates) is
+   cropped from the source frame of the open image at up to its native
+   resolution, into the model input buffer (see set_img_input_buffer). A point
+   (x, y) of the crop is at (x0 + x * scale, y0 + y * scale) in the ML image.
+   Returns false when the source has no higher resolution for the box. */
+struct img_roi_t {
+    float x0;       /* ML image X coordinate of the crop top-left corner */
+    float y0;       /* ML image Y coordinate of the crop top-left corner */
+    float scale;    /* ML image pixels per crop pixel */
+};
+bool read_img_roi(const uint32_t idx, const uint32_t x0,
+                                      const uint32_t y0,
+                                      const uint32_t w,
+                                      const uint32_t h,
+                                      img_roi_t *roi);
+
 #endif /* VIDEO_SOURCE_HPP__ */
\ No newline at end of file
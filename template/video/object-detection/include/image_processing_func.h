@@ -27,6 +27,11 @@
 #define BAYER_PATTERN_GRBG      2
 #define BAYER_PATTERN_GBRG      3
 
+/* YUV 4:2:0 format definitions */
+#define YUV_FORMAT_I420         0   ///< Planar: Y plane, U plane, V plane (YUV420)
+#define YUV_FORMAT_NV12         1   ///< Semi-planar: Y plane, interleaved U/V plane
+#define YUV_FORMAT_NV21         2   ///< Semi-planar: Y plane, interleaved V/U plane
+
 /* Image format definitions */
 #define IMAGE_FORMAT_GRAYSCALE  0   ///< 8-bit grayscale: 1 byte per pixel
 #define IMAGE_FORMAT_RGB565     1   ///< 16-bit RGB: 5 bits R, 6 bits G, 5 bits B
@@ -38,6 +43,152 @@ extern "C" {
 
 typedef int bayer_pattern_t;
 typedef int image_format_t;
+typedef int yuv_format_t;
+
+/**
+ * @brief Output row callback used by the streaming image processing functions.
+ *
+ * @param[in] row  Pointer to the output row. Valid only during the callback.
+ * @param[in] y    Index of the output row in the output image.
+ * @param[in] arg  User argument provided when the stream was initialized.
+ */
+typedef void (*image_row_callback_t)(const uint8_t *row, int y, void *arg);
+
+/* Number of source rows held in the line buffer of the streaming functions */
+#define IMAGE_DEBAYER_STREAM_LINES  3   ///< Rows needed by debayering (3x3 neighbourhood)
+#define IMAGE_RESIZE_STREAM_LINES   2   ///< Rows needed by bilinear resize
+
+/**
+ * @brief Precomputed sampling plan for @ref crop_and_debayer_planned.
+ *
+ * Holds the source column and row sampled for every output pixel, so the
+ * per-pixel fixed-point divides are done once when the plan is created.
+ */
+typedef struct {
+  int       src_width;    ///< Source image width in pixels
+  int       src_height;   ///< Source image height in pixels
+  int       dst_width;    ///< Output image width in pixels
+  int       dst_height;   ///< Output image height in pixels
+  uint16_t *col_idx;      ///< Source column for each output column (dst_width entries)
+  uint16_t *row_idx;      ///< Source row for each output row (dst_height entries)
+} crop_and_debayer_plan_t;
+
+/**
+ * @brief Precomputed sampling plan for @ref image_resize_planned.
+ *
+ * Holds source indices and bilinear weights for every output column and row,
+ * so the coordinate arithmetic is done once when the plan is created.
+ */
+typedef struct {
+  int       src_width;    ///< Source image width in pixels
+  int       src_height;   ///< Source image height in pixels
+  int       dst_width;    ///< Destination image width in pixels
+  int       dst_height;   ///< Destination image height in pixels
+  uint16_t *col_idx0;     ///< Left source column for each output column
+  uint16_t *col_idx1;     ///< Right source column for each output column
+  uint16_t *col_weight;   ///< Horizontal weight of the right column (fixed-point, 16 fractional bits)
+  uint16_t *row_idx0;     ///< Upper source row for each output row
+  uint16_t *row_idx1;     ///< Lower source row for each output row
+  uint16_t *row_weight;   ///< Vertical weight of the lower row (fixed-point, 16 fractional bits)
+} image_resize_plan_t;
+
+/* Number of uint16_t entries needed to store a plan for the given output size */
+#define CROP_AND_DEBAYER_PLAN_BUF_SIZE(dst_width, dst_height)  ((dst_width) + (dst_height))
+#define IMAGE_RESIZE_PLAN_BUF_SIZE(dst_width, dst_height)      (3 * ((dst_width) + (dst_height)))
+
+/**
+ * @brief 2D blit descriptor (see @ref image_blit).
+ *
+ * Places a source image of src_width × src_height pixels at (dst_x, dst_y)
+ * in a destination image. Both images use the same pixel format.
+ */
+typedef struct {
+  const uint8_t       *src;           ///< Source image
+  int                  src_width;     ///< Source width in pixels
+  int                  src_height;    ///< Source height in pixels
+  int                  src_stride;    ///< Source line size in bytes
+  uint8_t             *dst;           ///< Destination image
+  int                  dst_width;     ///< Destination width in pixels
+  int                  dst_height;    ///< Destination height in pixels
+  int                  dst_stride;    ///< Destination line size in bytes
+  int                  dst_x;         ///< X position of the source in the destination (may be negative)
+  int                  dst_y;         ///< Y position of the source in the destination (may be negative)
+  int                  bpp;           ///< Bytes per pixel
+} image_blit_t;
+
+/**
+ * @brief Completion callback of @ref image_blit_async.
+ *
+ * @param[in] status  0 on success, negative value on transfer error.
+ * @param[in] arg     User argument provided to @ref image_blit_async.
+ */
+typedef void (*image_blit_callback_t)(int status, void *arg);
+
+/**
+ * @brief Streaming debayer context (see @ref image_debayer_stream_init).
+ */
+typedef struct {
+  int                  width;         ///< Image width in pixels
+  int                  height;        ///< Image height in pixels
+  int                  offsets[2][2]; ///< Colour site offsets resolved from Bayer pattern
+  int                  swap_rb;       ///< Swap red and blue channels
+  uint8_t             *line_buf;      ///< Source line buffer (IMAGE_DEBAYER_STREAM_LINES × width bytes)
+  uint8_t             *out_row;       ///< Output row buffer (width × 3 bytes)
+  int                  src_y;         ///< Number of source rows received
+  image_row_callback_t callback;      ///< Output row callback
+  void                *arg;           ///< Output row callback argument
+} image_debayer_stream_t;
+
+/**
+ * @brief Streaming crop and debayer context (see @ref crop_and_debayer_stream_init).
+ */
+typedef struct {
+  int                  src_width;     ///< Source image width in pixels
+  int                  src_height;    ///< Source image height in pixels
+  int                  src_crop_x;    ///< X offset of the crop region
+  int                  src_crop_y;    ///< Y offset of the crop region
+  int                  dst_width;     ///< Output image width in pixels
+  int                  dst_height;    ///< Output image height in pixels
+  int                  offsets[2][2]; ///< Colour site offsets resolved from Bayer pattern
+  uint8_t             *line_buf;      ///< Source line buffer (IMAGE_DEBAYER_STREAM_LINES × src_width bytes)
+  uint8_t             *out_row;       ///< Output row buffer (dst_width × 3 bytes)
+  int                  src_y;         ///< Number of source rows received
+  int                  dst_y;         ///< Number of output rows emitted
+  image_row_callback_t callback;      ///< Output row callback
+  void                *arg;           ///< Output row callback argument
+} crop_and_debayer_stream_t;
+
+/**
+ * @brief Streaming resize context (see @ref image_resize_stream_init).
+ */
+typedef struct {
+  int                  src_width;     ///< Source image width in pixels
+  int                  src_height;    ///< Source image height in pixels
+  int                  dst_width;     ///< Destination image width in pixels
+  int                  dst_height;    ///< Destination image height in pixels
+  image_format_t       src_format;    ///< Source image format
+  image_format_t       dst_format;    ///< Destination image format
+  int                  x_ratio;       ///< Horizontal scaling ratio (fixed-point)
+  int                  y_ratio;       ///< Vertical scaling ratio (fixed-point)
+  uint8_t             *line_buf;      ///< Source line buffer (IMAGE_RESIZE_STREAM_LINES × src_width × src_bpp bytes)
+  uint8_t             *out_row;       ///< Output row buffer (dst_width × dst_bpp bytes)
+  int                  src_y;         ///< Number of source rows received
+  int                  dst_y;         ///< Number of output rows emitted
+  image_row_callback_t callback;      ///< Output row callback
+  void                *arg;           ///< Output row callback argument
+} image_resize_stream_t;
+
+/**
+ * @brief Resolve a Bayer pattern into colour site offsets.
+ *
+ * The colour site of a pixel is offsets[row & 1][col & 1], where 0 is blue,
+ * 1 is green and 2 is red. Shared by the scalar and Helium kernels, an
+ * unknown pattern gives all zero offsets.
+ *
+ * @param[in]  pattern  Bayer pattern used in the RAW8 image (see @ref bayer_pattern_t).
+ * @param[out] offsets  Colour site offsets for each row and column parity.
+ */
+void bayer_offsets(bayer_pattern_t pattern, int offsets[2][2]);
 
 /**
  * @brief Perform debayering on a raw Bayer image.
@@ -48,13 +199,16 @@ typedef int image_format_t;
  * use 8-bit grayscale pixels. The output RGB image is stored as 24-bit RGB
  * (3 bytes per pixel, in R-G-B order). Supports optional red/blue channel swap.
  *
- * Note: The outer 1-pixel border is skipped to avoid accessing out-of-bounds
- * pixels. These edges will remain unprocessed unless handled separately.
+ * The Bayer pattern is resolved once per call and pixels are processed per
+ * 2x2 quad position, each with a fixed interpolation formula. All pixels are
+ * written: at the image border the missing neighbours are replaced by the
+ * mirrored ones (row -1 by row 1, column -1 by column 1, and so on), which
+ * have the same colour site.
  *
  * @param[in]  raw      Pointer to the raw Bayer image buffer (size: width × height).
  * @param[out] rgb      Pointer to the output RGB buffer (size: width × height × 3).
- * @param[in]  width    Width of the image in pixels.
- * @param[in]  height   Height of the image in pixels.
+ * @param[in]  width    Width of the image in pixels (at least 2).
+ * @param[in]  height   Height of the image in pixels (at least 2).
  * @param[in]  pattern  Bayer pattern used in the raw image.
  * @param[in]  swap_rb  If non-zero, swap the red and blue channels in the output.
  */
@@ -93,6 +247,80 @@ void crop_and_debayer(const uint8_t *src,
                       int dst_height,
                       bayer_pattern_t pattern);
 
+/**
+ * @brief Crop, debayer and scale a RAW8 Bayer image directly into model input data.
+ *
+ * Same sampling as @ref crop_and_debayer, but intended to run at model input
+ * resolution and write straight into the model input tensor. This replaces the
+ * separate debayer, resize and input conversion passes and their intermediate
+ * buffers.
+ *
+ * The output layout follows the model input: RGB888, or grayscale where every
+ * pixel is the luma of the debayered colour, Y = (77R + 150G + 29B) >> 8.
+ * When @p is_signed is non-zero, every output value is converted to int8 by
+ * subtracting 128 (as done by the model pre-processing for signed models),
+ * otherwise the output is plain uint8.
+ *
+ * @param[in]  src           Pointer to the input RAW8 image buffer.
+ * @param[in]  src_width     Width of the input RAW8 image in pixels.
+ * @param[in]  src_height    Height of the input RAW8 image in pixels.
+ * @param[in]  src_crop_x    X offset of the top-left corner of the crop region.
+ * @param[in]  src_crop_y    Y offset of the top-left corner of the crop region.
+ * @param[out] dst           Pointer to the model input data. Must be at least dst_width * dst_height * bytes per pixel.
+ * @param[in]  dst_width     Width of the model input in pixels.
+ * @param[in]  dst_height    Height of the model input in pixels.
+ * @param[in]  pattern       Bayer pattern used in the RAW8 image (see @ref bayer_pattern_t).
+ * @param[in]  dst_format    Model input layout, IMAGE_FORMAT_RGB888 or IMAGE_FORMAT_GRAYSCALE.
+ *                           Other formats are not supported and leave the output untouched.
+ * @param[in]  is_signed     If non-zero, output is written as int8, otherwise as uint8.
+ */
+void crop_and_debayer_to_input(const uint8_t *src,
+                               int src_width,
+                               int src_height,
+                               int src_crop_x,
+                               int src_crop_y,
+                               void *dst,
+                               int dst_width,
+                               int dst_height,
+                               bayer_pattern_t pattern,
+                               image_format_t dst_format,
+                               int is_signed);
+
+/**
+ * @brief Crop a region from a RAW8 Bayer image and downscale it to RGB888 by an integer factor.
+ *
+ * Each output pixel is the box-filtered average of a factor x factor block of
+ * Bayer samples: red and blue are averaged over their sites in the block and
+ * green over its sites. Rows are read sequentially, which suits camera frames
+ * in slow external memory, and the averaging avoids the aliasing of
+ * point-sampled downscaling.
+ *
+ * The crop region is dst_width * factor by dst_height * factor pixels starting
+ * at (src_crop_x, src_crop_y) and must lie within the source image, otherwise
+ * nothing is written.
+ *
+ * @param[in]  src           Pointer to the input RAW8 image buffer.
+ * @param[in]  src_width     Width of the input RAW8 image in pixels.
+ * @param[in]  src_height    Height of the input RAW8 image in pixels.
+ * @param[in]  src_crop_x    X offset of the top-left corner of the crop region.
+ * @param[in]  src_crop_y    Y offset of the top-left corner of the crop region.
+ * @param[out] dst_rgb       Pointer to the output RGB888 buffer. Must be at least dst_width * dst_height * 3 bytes.
+ * @param[in]  dst_width     Width of the output image in pixels.
+ * @param[in]  dst_height    Height of the output image in pixels.
+ * @param[in]  factor        Decimation factor (2, 4 or 8).
+ * @param[in]  pattern       Bayer pattern used in the RAW8 image (see @ref bayer_pattern_t).
+ */
+void crop_and_debayer_decimate(const uint8_t *src,
+                               int src_width,
+                               int src_height,
+                               int src_crop_x,
+                               int src_crop_y,
+                               uint8_t *dst_rgb,
+                               int dst_width,
+                               int dst_height,
+                               int factor,
+                               bayer_pattern_t pattern);
+
 /**
  * @brief Resize an image with format conversion.
  *
@@ -101,7 +329,8 @@ void crop_and_debayer(const uint8_t *src,
  * between grayscale, RGB565, and RGB888 formats.
  *
  * Format handling:
- * - Grayscale is treated as luminance; RGB conversions are done via luminance (Y = 0.299R + 0.587G + 0.114B).
+ * - Grayscale is treated as luminance; RGB conversions are done via luminance (Y = 0.299R + 0.587G + 0.114B),
+ *   computed with integer weights as Y = (77R + 150G + 29B) >> 8.
  * - RGB565 is unpacked and interpolated as RGB888 for better accuracy.
  *
  * @param src         Pointer to the source image buffer.
@@ -118,6 +347,9 @@ void crop_and_debayer(const uint8_t *src,
  *       - GRAYSCALE: 1 byte per pixel
  *       - RGB565:    2 bytes per pixel
  *       - RGB888:    3 bytes per pixel
+ *
+ * @note A dedicated kernel is selected once per call for each (src_format, dst_format)
+ *       pair; unsupported formats leave the destination unchanged.
  */
 void image_resize(const uint8_t *src,
                   int src_width,
@@ -128,10 +360,51 @@ void image_resize(const uint8_t *src,
                   image_format_t src_format,
                   image_format_t dst_format);
 
+/**
+ * @brief Downscale an image by an integer factor with format conversion.
+ *
+ * Box-filter decimation: every destination pixel is the rounded average of a
+ * factor x factor block of source pixels. Compared to @ref image_resize this
+ * reads the source rows sequentially and does not alias, so it should be used
+ * whenever the scaling ratio is exactly 2, 4 or 8
+ * (see @ref image_decimation_factor).
+ *
+ * The destination size is (src_width / factor) x (src_height / factor).
+ *
+ * @param src         Pointer to the source image buffer.
+ * @param src_width   Width of the source image in pixels.
+ * @param src_height  Height of the source image in pixels.
+ * @param dst         Pointer to the destination image buffer.
+ * @param factor      Decimation factor (2, 4 or 8).
+ * @param src_format  Format of the source image (GRAYSCALE, RGB565, or RGB888).
+ * @param dst_format  Format of the destination image (GRAYSCALE, RGB565, or RGB888).
+ */
+void image_decimate(const uint8_t *src,
+                    int src_width,
+                    int src_height,
+                    uint8_t *dst,
+                    int factor,
+                    image_format_t src_format,
+                    image_format_t dst_format);
+
+/**
+ * @brief Get integer decimation factor for a resize operation.
+ *
+ * @param src_width   Width of the source image in pixels.
+ * @param src_height  Height of the source image in pixels.
+ * @param dst_width   Width of the destination image in pixels.
+ * @param dst_height  Height of the destination image in pixels.
+ * @return            2, 4 or 8 if both dimensions are downscaled by exactly that factor, otherwise 0.
+ */
+int image_decimation_factor(int src_width,
+                            int src_height,
+                            int dst_width,
+                            int dst_height);
+
 /**
  * @brief Copy a smaller or equally sized image into a destination frame buffer at a given offset.
  *
- * Assumes that the source image fits completely within the destination at the specified offset.
+ * Parts of the source image outside of the destination are clipped (see @ref image_blit).
  * It assumes both source and destination use the same format (grayscale, RGB565, or RGB888).
  *
  * @param src        Pointer to the source image buffer.
@@ -155,6 +428,128 @@ void image_copy_to_framebuffer(const uint8_t *src,
                                image_format_t format);
 
 
+/**
+ * @brief Compute a downscaled luma thumbnail of an RGB888 or grayscale image.
+ *
+ * Every thumbnail pixel is the rounded average of (R + 2G + B) / 4 (or of the
+ * grayscale value) over a factor x factor block. Intended for cheap scene
+ * change detection with @ref image_sad. Trailing pixels that do not fill a
+ * block are ignored.
+ *
+ * @param src         Pointer to the source image.
+ * @param src_width   Width of the source image in pixels.
+ * @param src_height  Height of the source image in pixels.
+ * @param format      Format of the source image (RGB888 or GRAYSCALE).
+ * @param dst         Pointer to the thumbnail ((src_width / factor) x (src_height / factor) bytes).
+ * @param factor      Downscale factor (2, 4 or 8).
+ * @param is_signed   Non-zero if the source pixels are stored as int8 (model input).
+ */
+void image_luma_thumbnail(const uint8_t *src,
+                          int src_width,
+                          int src_height,
+                          image_format_t format,
+                          uint8_t *dst,
+                          int factor,
+                          int is_signed);
+
+/**
+ * @brief Sum of absolute differences of two 8-bit buffers.
+ *
+ * @param a     Pointer to the first buffer.
+ * @param b     Pointer to the second buffer.
+ * @param size  Number of bytes to compare.
+ * @return      Sum of |a[i] - b[i]|.
+ */
+uint32_t image_sad(const uint8_t *a, const uint8_t *b, int size);
+
+/**
+ * @brief Convert uint8 image data to int8 in place.
+ *
+ * Every value is converted by subtracting 128, as done by the model
+ * pre-processing for signed models.
+ *
+ * @param buf   Pointer to the image data.
+ * @param size  Size of the image data in bytes.
+ */
+void image_to_int8(uint8_t *buf, int size);
+
+/**
+ * @brief Expand a grayscale image to RGB888.
+ *
+ * Every gray value is written to the R, G and B bytes of its pixel. Signed
+ * (int8) gray values are converted back to uint8 by adding 128, which
+ * reverses @ref image_to_int8.
+ *
+ * @param src         Pointer to the grayscale image.
+ * @param src_stride  Line size of the grayscale image in bytes.
+ * @param dst         Pointer to the RGB888 image.
+ * @param dst_stride  Line size of the RGB888 image in bytes.
+ * @param width       Width of the image in pixels.
+ * @param height      Height of the image in pixels.
+ * @param is_signed   Non-zero when the gray values are int8.
+ */
+void image_gray_to_rgb888(const uint8_t *src,
+                          int src_stride,
+                          uint8_t *dst,
+                          int dst_stride,
+                          int width,
+                          int height,
+                          int is_signed);
+
+/**
+ * @brief Clip a 2D blit against the destination image.
+ *
+ * @param[in]  blit     Pointer to the blit descriptor.
+ * @param[out] clipped  Pointer to the clipped descriptor. Its src and dst point
+ *                      to the first visible pixel, src_width/src_height hold the
+ *                      visible size and dst_x/dst_y are zero.
+ * @return              Non-zero if any part of the source is visible, otherwise 0.
+ */
+int image_blit_clip(const image_blit_t *blit, image_blit_t *clipped);
+
+/**
+ * @brief Copy a source image into a destination image (2D blit).
+ *
+ * Clipping against the destination is computed once per call and the visible
+ * part is copied row by row with memcpy, or in a single memcpy when both
+ * images are contiguous.
+ *
+ * @param[in] blit  Pointer to the blit descriptor.
+ */
+void image_blit(const image_blit_t *blit);
+
+/**
+ * @brief Start an asynchronous 2D blit.
+ *
+ * On targets with a DMA-350 (Corstone-310/315/320 with the DMA350 native
+ * driver selected) the copy is done by the DMA and the callback is called from
+ * the DMA interrupt when it completes. Otherwise the copy is done synchronously
+ * with @ref image_blit and the callback is called before this function returns.
+ *
+ * Source and destination must not be modified or reused until the callback is
+ * called. Only one blit can be in progress at a time.
+ *
+ * @param[in] blit      Pointer to the blit descriptor (not needed after return).
+ * @param[in] callback  Completion callback (may be NULL).
+ * @param[in] arg       User argument passed to the callback.
+ * @return              0 if the blit was started, negative value if busy or failed.
+ */
+int image_blit_async(const image_blit_t *blit, image_blit_callback_t callback, void *arg);
+
+/**
+ * @brief Fill a rectangle of an RGB888 image with a solid color.
+ *
+ * Rows are written as horizontal spans of whole words (vectors on targets
+ * with Helium). Used to draw overlay lines and boxes into display frames.
+ *
+ * @param[out] dst     Pointer to the top-left pixel of the rectangle.
+ * @param[in]  stride  Image line size in bytes.
+ * @param[in]  width   Rectangle width in pixels.
+ * @param[in]  height  Rectangle height in pixels.
+ * @param[in]  color   Fill color as 0xRRGGBB.
+ */
+void image_fill_rgb888(uint8_t *dst, int stride, int width, int height, uint32_t color);
+
 /**
  * @brief Convert an RGB565 image to RGB888 format.
  *
@@ -219,6 +614,311 @@ void crop_rgb888_to_rgb888(const uint8_t *src,
                            int crop_y,
                            int crop_width,
                            int crop_height);
+
+/**
+ * @brief Crop, resize and convert a YUV 4:2:0 image in a single pass.
+ *
+ * The crop region is scaled to the destination size with nearest sampling and
+ * converted from YUV (ITU-R BT.601, limited range) to the destination format.
+ * When the destination format is GRAYSCALE, only the luma (Y) plane is read
+ * and expanded to full range, which is the fast path for grayscale models.
+ * The result is the luma of the RGB888 conversion (see @ref image_resize),
+ * exactly for neutral chroma and within one level otherwise, unless an RGB
+ * component of the conversion is clipped.
+ *
+ * A YUV 4:2:0 frame is src_width × src_height × 1.5 bytes: a full resolution
+ * Y plane followed by the chroma samples of every 2x2 pixel block, either as
+ * separate U and V planes (I420) or as one interleaved plane (NV12, NV21).
+ *
+ * @param src           Pointer to the input YUV 4:2:0 image buffer.
+ * @param src_width     Width of the source image in pixels.
+ * @param src_height    Height of the source image in pixels.
+ * @param src_crop_x    X coordinate of the top-left corner of the crop region.
+ * @param src_crop_y    Y coordinate of the top-left corner of the crop region.
+ * @param crop_width    Width of the crop region in pixels.
+ * @param crop_height   Height of the crop region in pixels.
+ * @param dst           Pointer to the destination image buffer.
+ * @param dst_width     Width of the destination image in pixels.
+ * @param dst_height    Height of the destination image in pixels.
+ * @param yuv_format    Layout of the source image (I420, NV12 or NV21).
+ * @param dst_format    Format of the destination image (GRAYSCALE, RGB565, or RGB888).
+ */
+void crop_and_resize_yuv420(const uint8_t *src,
+                            int src_width,
+                            int src_height,
+                            int src_crop_x,
+                            int src_crop_y,
+                            int crop_width,
+                            int crop_height,
+                            uint8_t *dst,
+                            int dst_width,
+                            int dst_height,
+                            yuv_format_t yuv_format,
+                            image_format_t dst_format);
+
+/**
+ * @brief Initialize streaming (line-buffered) debayering.
+ *
+ * Streaming variant of @ref image_debayer. Source rows are pushed with
+ * @ref image_debayer_stream_push and output rows are delivered through the
+ * callback as soon as their neighbourhood is available, so neither the whole
+ * raw image nor the whole RGB image needs to be resident in memory.
+ *
+ * All output rows are emitted, row y once source row y+1 has been pushed and
+ * the last row together with the previous one. Output is identical to
+ * @ref image_debayer.
+ *
+ * @param[out] stream    Pointer to the stream context.
+ * @param[in]  width     Width of the image in pixels.
+ * @param[in]  height    Height of the image in pixels.
+ * @param[in]  pattern   Bayer pattern used in the raw image.
+ * @param[in]  swap_rb   If non-zero, swap the red and blue channels in the output.
+ * @param[in]  line_buf  Line buffer (size: IMAGE_DEBAYER_STREAM_LINES × width).
+ * @param[in]  out_row   Output row buffer (size: width × 3).
+ * @param[in]  callback  Function called for every output row.
+ * @param[in]  arg       User argument passed to the callback.
+ */
+void image_debayer_stream_init(image_debayer_stream_t *stream,
+                               int width,
+                               int height,
+                               bayer_pattern_t pattern,
+                               int swap_rb,
+                               uint8_t *line_buf,
+                               uint8_t *out_row,
+                               image_row_callback_t callback,
+                               void *arg);
+
+/**
+ * @brief Push raw source rows into a streaming debayer.
+ *
+ * @param[in,out] stream    Pointer to the stream context.
+ * @param[in]     rows      Pointer to consecutive raw rows (size: num_rows × width).
+ * @param[in]     num_rows  Number of rows to push.
+ * @return                  Number of output rows emitted during this call.
+ */
+int image_debayer_stream_push(image_debayer_stream_t *stream,
+                              const uint8_t *rows,
+                              int num_rows);
+
+/**
+ * @brief Initialize streaming (line-buffered) crop and debayering.
+ *
+ * Streaming variant of @ref crop_and_debayer. Source rows are pushed with
+ * @ref crop_and_debayer_stream_push, starting with row 0 of the source image.
+ * Output rows are delivered through the callback and are identical to the
+ * output of @ref crop_and_debayer.
+ *
+ * @param[out] stream      Pointer to the stream context.
+ * @param[in]  src_width   Width of the input RAW8 image in pixels.
+ * @param[in]  src_height  Height of the input RAW8 image in pixels.
+ * @param[in]  src_crop_x  X offset of the top-left corner of the crop region.
+ * @param[in]  src_crop_y  Y offset of the top-left corner of the crop region.
+ * @param[in]  dst_width   Width of the output image in pixels.
+ * @param[in]  dst_height  Height of the output image in pixels.
+ * @param[in]  pattern     Bayer pattern used in the RAW8 image.
+ * @param[in]  line_buf    Line buffer (size: IMAGE_DEBAYER_STREAM_LINES × src_width).
+ * @param[in]  out_row     Output row buffer (size: dst_width × 3).
+ * @param[in]  callback    Function called for every output row.
+ * @param[in]  arg         User argument passed to the callback.
+ */
+void crop_and_debayer_stream_init(crop_and_debayer_stream_t *stream,
+                                  int src_width,
+                                  int src_height,
+                                  int src_crop_x,
+                                  int src_crop_y,
+                                  int dst_width,
+                                  int dst_height,
+                                  bayer_pattern_t pattern,
+                                  uint8_t *line_buf,
+                                  uint8_t *out_row,
+                                  image_row_callback_t callback,
+                                  void *arg);
+
+/**
+ * @brief Push RAW8 source rows into a streaming crop and debayer.
+ *
+ * @param[in,out] stream    Pointer to the stream context.
+ * @param[in]     rows      Pointer to consecutive RAW8 rows (size: num_rows × src_width).
+ * @param[in]     num_rows  Number of rows to push.
+ * @return                  Number of output rows emitted during this call.
+ */
+int crop_and_debayer_stream_push(crop_and_debayer_stream_t *stream,
+                                 const uint8_t *rows,
+                                 int num_rows);
+
+/**
+ * @brief Initialize streaming (line-buffered) resize with format conversion.
+ *
+ * Streaming variant of @ref image_resize. Source rows are pushed with
+ * @ref image_resize_stream_push and output rows are delivered through the
+ * callback as soon as both of their source rows are available. Output rows
+ * are identical to the output of @ref image_resize.
+ *
+ * @param[out] stream      Pointer to the stream context.
+ * @param[in]  src_width   Width of the source image in pixels.
+ * @param[in]  src_height  Height of the source image in pixels.
+ * @param[in]  dst_width   Width of the destination image in pixels.
+ * @param[in]  dst_height  Height of the destination image in pixels.
+ * @param[in]  src_format  Format of the source image.
+ * @param[in]  dst_format  Format of the destination image.
+ * @param[in]  line_buf    Line buffer (size: IMAGE_RESIZE_STREAM_LINES × src_width × src_bpp).
+ * @param[in]  out_row     Output row buffer (size: dst_width × dst_bpp).
+ * @param[in]  callback    Function called for every output row.
+ * @param[in]  arg         User argument passed to the callback.
+ */
+void image_resize_stream_init(image_resize_stream_t *stream,
+                              int src_width,
+                              int src_height,
+                              int dst_width,
+                              int dst_height,
+                              image_format_t src_format,
+                              image_format_t dst_format,
+                              uint8_t *line_buf,
+                              uint8_t *out_row,
+                              image_row_callback_t callback,
+                              void *arg);
+
+/**
+ * @brief Push source rows into a streaming resize.
+ *
+ * @param[in,out] stream    Pointer to the stream context.
+ * @param[in]     rows      Pointer to consecutive source rows (size: num_rows × src_width × src_bpp).
+ * @param[in]     num_rows  Number of rows to push.
+ * @return                  Number of output rows emitted during this call.
+ */
+int image_resize_stream_push(image_resize_stream_t *stream,
+                             const uint8_t *rows,
+                             int num_rows);
+
+/**
+ * @brief Create a sampling plan for @ref crop_and_debayer_planned.
+ *
+ * The plan is computed once for a fixed geometry and can then be reused for
+ * every frame. Parameters have the same meaning as in @ref crop_and_debayer.
+ *
+ * @param[out] plan        Pointer to the plan.
+ * @param[in]  buf         Plan storage (CROP_AND_DEBAYER_PLAN_BUF_SIZE(dst_width, dst_height) entries).
+ * @param[in]  src_width   Width of the input RAW8 image in pixels.
+ * @param[in]  src_height  Height of the input RAW8 image in pixels.
+ * @param[in]  src_crop_x  X offset of the top-left corner of the crop region.
+ * @param[in]  src_crop_y  Y offset of the top-left corner of the crop region.
+ * @param[in]  dst_width   Width of the output image in pixels.
+ * @param[in]  dst_height  Height of the output image in pixels.
+ */
+void crop_and_debayer_plan_init(crop_and_debayer_plan_t *plan,
+                                uint16_t *buf,
+                                int src_width,
+                                int src_height,
+                                int src_crop_x,
+                                int src_crop_y,
+                                int dst_width,
+                                int dst_height);
+
+/**
+ * @brief Create a sampling plan for @ref crop_and_debayer_planned covering an
+ *        arbitrary window of the source image.
+ *
+ * Unlike @ref crop_and_debayer_plan_init, where the crop region is centered,
+ * the window can be placed anywhere in the source image, e.g. to re-sample a
+ * region of interest at a higher resolution.
+ *
+ * @param[out] plan        Pointer to the plan.
+ * @param[in]  buf         Plan storage (CROP_AND_DEBAYER_PLAN_BUF_SIZE(dst_width, dst_height) entries).
+ * @param[in]  src_width   Width of the input RAW8 image in pixels.
+ * @param[in]  src_height  Height of the input RAW8 image in pixels.
+ * @param[in]  win_x       X offset of the top-left corner of the window.
+ * @param[in]  win_y       Y offset of the top-left corner of the window.
+ * @param[in]  win_width   Width of the window in pixels.
+ * @param[in]  win_height  Height of the window in pixels.
+ * @param[in]  dst_width   Width of the output image in pixels.
+ * @param[in]  dst_height  Height of the output image in pixels.
+ */
+void crop_and_debayer_window_plan_init(crop_and_debayer_plan_t *plan,
+                                       uint16_t *buf,
+                                       int src_width,
+                                       int src_height,
+                                       int win_x,
+                                       int win_y,
+                                       int win_width,
+                                       int win_height,
+                                       int dst_width,
+                                       int dst_height);
+
+/**
+ * @brief Crop and debayer a RAW8 Bayer image using a precomputed plan.
+ *
+ * Produces the same output as @ref crop_and_debayer (or as
+ * @ref crop_and_debayer_to_input when @p is_signed is non-zero), without
+ * per-pixel coordinate computation.
+ *
+ * @param[in]  plan       Pointer to the plan created by @ref crop_and_debayer_plan_init.
+ * @param[in]  src        Pointer to the input RAW8 image buffer.
+ * @param[out] dst        Pointer to the output RGB888 buffer.
+ * @param[in]  pattern    Bayer pattern used in the RAW8 image.
+ * @param[in]  is_signed  If non-zero, output is written as int8, otherwise as uint8.
+ */
+void crop_and_debayer_planned(const crop_and_debayer_plan_t *plan,
+                              const uint8_t *src,
+                              void *dst,
+                              bayer_pattern_t pattern,
+                              int is_signed);
+
+/**
+ * @brief Crop and debayer a RAW8 Bayer image into a grayscale image using a
+ *        precomputed plan.
+ *
+ * Same sampling as @ref crop_and_debayer_planned, every output pixel is the
+ * luma of the debayered colour: Y = (77R + 150G + 29B) >> 8.
+ *
+ * @param[in]  plan       Pointer to the plan created by @ref crop_and_debayer_plan_init.
+ * @param[in]  src        Pointer to the input RAW8 image buffer.
+ * @param[out] dst        Pointer to the output grayscale buffer (dst_width x dst_height bytes).
+ * @param[in]  pattern    Bayer pattern used in the RAW8 image.
+ * @param[in]  is_signed  If non-zero, output is written as int8, otherwise as uint8.
+ */
+void crop_and_debayer_planned_gray(const crop_and_debayer_plan_t *plan,
+                                   const uint8_t *src,
+                                   uint8_t *dst,
+                                   bayer_pattern_t pattern,
+                                   int is_signed);
+
+/**
+ * @brief Create a sampling plan for @ref image_resize_planned.
+ *
+ * The plan is computed once for a fixed geometry and can then be reused for
+ * every frame and for any combination of image formats.
+ *
+ * @param[out] plan        Pointer to the plan.
+ * @param[in]  buf         Plan storage (IMAGE_RESIZE_PLAN_BUF_SIZE(dst_width, dst_height) entries).
+ * @param[in]  src_width   Width of the source image in pixels.
+ * @param[in]  src_height  Height of the source image in pixels.
+ * @param[in]  dst_width   Width of the destination image in pixels.
+ * @param[in]  dst_height  Height of the destination image in pixels.
+ */
+void image_resize_plan_init(image_resize_plan_t *plan,
+                            uint16_t *buf,
+                            int src_width,
+                            int src_height,
+                            int dst_width,
+                            int dst_height);
+
+/**
+ * @brief Resize an image with format conversion using a precomputed plan.
+ *
+ * Produces the same output as @ref image_resize, without per-pixel
+ * coordinate and weight computation.
+ *
+ * @param[in]  plan        Pointer to the plan created by @ref image_resize_plan_init.
+ * @param[in]  src         Pointer to the source image buffer.
+ * @param[out] dst         Pointer to the destination image buffer.
+ * @param[in]  src_format  Format of the source image (GRAYSCALE, RGB565, or RGB888).
+ * @param[in]  dst_format  Format of the destination image (GRAYSCALE, RGB565, or RGB888).
+ */
+void image_resize_planned(const image_resize_plan_t *plan,
+                          const uint8_t *src,
+                          uint8_t *dst,
+                          image_format_t src_format,
+                          image_format_t dst_format);
 #ifdef __cplusplus
 }
 #endif
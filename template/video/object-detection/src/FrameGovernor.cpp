@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FrameGovernor.hpp"
+
+#if (FRAME_GOVERNOR != 0)
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "VideoSource.hpp"
+#include "cmsis_os2.h"
+
+/* Names of the quality levels */
+static const char* const levelName[GOVERNOR_LEVEL_COUNT] = {
+    "full quality",
+    "skip display",
+    "reduce resolution",
+    "skip inference"
+};
+
+FrameGovernor::FrameGovernor()
+    : m_level{GOVERNOR_FULL_QUALITY},
+      m_image{0},
+      m_start{0},
+      m_budget{0},
+      m_period{0},
+      m_nextTick{0},
+      m_sum{0},
+      m_count{0},
+      m_canReduce{false}
+{
+}
+
+void FrameGovernor::Start()
+{
+    const uint64_t freq = osKernelGetSysTimerFreq();
+    const uint32_t tickFreq = osKernelGetTickFreq();
+
+    m_budget = (FRAME_GOVERNOR_BUDGET_MS != 0) ?
+               static_cast<uint32_t>((freq * FRAME_GOVERNOR_BUDGET_MS) / 1000U) :
+               static_cast<uint32_t>(freq / FRAME_GOVERNOR_FPS);
+    m_period = (tickFreq >= FRAME_GOVERNOR_FPS) ? (tickFreq / FRAME_GOVERNOR_FPS) : 1U;
+
+    /* Check whether the image source supports the reduced resolution */
+    m_canReduce = set_img_resolution_reduced(true);
+    set_img_resolution_reduced(false);
+
+    m_level    = GOVERNOR_FULL_QUALITY;
+    m_image    = 0;
+    m_sum      = 0;
+    m_count    = 0;
+    Apply();
+
+    m_nextTick = osKernelGetTickCount();
+    m_start    = osKernelGetSysTimerCount();
+}
+
+void FrameGovernor::NextImage()
+{
+    /* Processing time of the image, without the wait for the frame period */
+    m_sum += osKernelGetSysTimerCount() - m_start;
+
+    if (++m_count == FRAME_GOVERNOR_WINDOW) {
+        const uint64_t avg = m_sum / m_count;
+        const GovernorLevel level = m_level;
+
+        if (avg > m_budget) {
+            Step(true);
+        } else if ((avg * 100U) < (static_cast<uint64_t>(m_budget) * FRAME_GOVERNOR_STEP_UP)) {
+            Step(false);
+        }
+
+        if (m_level != level) {
+            printf("Governor: %s, average image time %" PRIu32 " us\n", levelName[m_level],
+                   static_cast<uint32_t>((avg * 1000000U) / osKernelGetSysTimerFreq()));
+        }
+        m_sum   = 0;
+        m_count = 0;
+    }
+
+    /* Wait for the next frame period, a late image restarts the schedule */
+    m_nextTick += m_period;
+    const uint32_t tick = osKernelGetTickCount();
+    if (static_cast<int32_t>(m_nextTick - tick) > 0) {
+        osDelayUntil(m_nextTick);
+    } else {
+        m_nextTick = tick;
+    }
+
+    m_image++;
+    Apply();
+    m_start = osKernelGetSysTimerCount();
+}
+
+bool FrameGovernor::InferImage() const
+{
+    return (m_level < GOVERNOR_SKIP_INFERENCE) || ((m_image & 1U) == 0U);
+}
+
+GovernorLevel FrameGovernor::GetLevel() const
+{
+    return m_level;
+}
+
+void FrameGovernor::Step(bool down)
+{
+    int32_t level = static_cast<int32_t>(m_level) + (down ? 1 : -1);
+
+    if ((level == GOVERNOR_REDUCE_RESOLUTION) && !m_canReduce) {
+        level += down ? 1 : -1;
+    }
+    if ((level < 0) || (level >= GOVERNOR_LEVEL_COUNT)) {
+        return;
+    }
+
+    m_level = static_cast<GovernorLevel>(level);
+    if (m_canReduce) {
+        set_img_resolution_reduced(m_level >= GOVERNOR_REDUCE_RESOLUTION);
+    }
+}
+
+void FrameGovernor::Apply()
+{
+    set_img_display_enabled((m_level < GOVERNOR_SKIP_DISPLAY) || ((m_image & 1U) == 0U));
+}
+
+#endif /* FRAME_GOVERNOR != 0 */
@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ObjectTracker.hpp"
+
+/* Maximum number of detections per image considered for association */
+#define TRACKER_MAX_DETECTIONS  32
+
+/* Gains of the alpha-beta filter for box position/size and velocity */
+static constexpr float kAlpha = 0.75f;
+static constexpr float kBeta  = 0.25f;
+
+/* Box with corner coordinates */
+struct Box {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+};
+
+/**
+ * @brief   Computes the intersection over union of two boxes.
+ */
+static float box_iou(const Box& a, const Box& b)
+{
+    const float ix = ((a.x1 < b.x1) ? a.x1 : b.x1) - ((a.x0 > b.x0) ? a.x0 : b.x0);
+    const float iy = ((a.y1 < b.y1) ? a.y1 : b.y1) - ((a.y0 > b.y0) ? a.y0 : b.y0);
+
+    if ((ix <= 0.0f) || (iy <= 0.0f)) {
+        return 0.0f;
+    }
+
+    const float inter = ix * iy;
+    const float uni   = (a.x1 - a.x0) * (a.y1 - a.y0) + (b.x1 - b.x0) * (b.y1 - b.y0) - inter;
+    return (uni > 0.0f) ? (inter / uni) : 0.0f;
+}
+
+/**
+ * @brief   Gets the predicted box of a track.
+ */
+static Box track_box(const TrackedObject& t)
+{
+    return Box{t.cx - 0.5f * t.w, t.cy - 0.5f * t.h, t.cx + 0.5f * t.w, t.cy + 0.5f * t.h};
+}
+
+/**
+ * @brief   Gets the box of a detection result.
+ */
+static Box detection_box(const arm::app::object_detection::DetectionResult& d)
+{
+    const float x0 = static_cast<float>(d.m_x0);
+    const float y0 = static_cast<float>(d.m_y0);
+    return Box{x0, y0, x0 + static_cast<float>(d.m_w), y0 + static_cast<float>(d.m_h)};
+}
+
+ObjectTracker::ObjectTracker(uint32_t imgWidth, uint32_t imgHeight)
+    : m_tracks{},
+      m_count{0},
+      m_nextId{0},
+      m_imgWidth{static_cast<float>(imgWidth)},
+      m_imgHeight{static_cast<float>(imgHeight)}
+{
+}
+
+void ObjectTracker::Reset()
+{
+    m_count = 0;
+}
+
+void ObjectTracker::Predict()
+{
+    for (size_t i = 0; i < m_count; i++) {
+        m_tracks[i].cx += m_tracks[i].vx;
+        m_tracks[i].cy += m_tracks[i].vy;
+        m_tracks[i].frames++;
+    }
+}
+
+void ObjectTracker::Update(const std::vector<arm::app::object_detection::DetectionResult>& detections)
+{
+    const float threshold = static_cast<float>(APP_TRACKER_IOU_THRESHOLD) / 100.0f;
+    const size_t numDet = (detections.size() < TRACKER_MAX_DETECTIONS) ? detections.size() : TRACKER_MAX_DETECTIONS;
+
+    bool trackMatched[APP_TRACKER_MAX_TRACKS] = {};
+    bool detMatched[TRACKER_MAX_DETECTIONS] = {};
+
+    /* Move the tracks to the current image */
+    Predict();
+
+    /* Greedy association, the pair with the highest IoU first */
+    for (;;) {
+        float  bestIou   = 0.0f;
+        size_t bestTrack = 0;
+        size_t bestDet   = 0;
+
+        for (size_t t = 0; t < m_count; t++) {
+            if (trackMatched[t]) {
+                continue;
+            }
+            const Box tb = track_box(m_tracks[t]);
+            for (size_t d = 0; d < numDet; d++) {
+                if (detMatched[d]) {
+                    continue;
+                }
+                const float iou = box_iou(tb, detection_box(detections[d]));
+                if (iou > bestIou) {
+                    bestIou   = iou;
+                    bestTrack = t;
+                    bestDet   = d;
+                }
+            }
+        }
+
+        if (bestIou < threshold) {
+            break;
+        }
+
+        /* Correct the prediction with the detection */
+        TrackedObject& track = m_tracks[bestTrack];
+        const Box db = detection_box(detections[bestDet]);
+        const float rx = 0.5f * (db.x0 + db.x1) - track.cx;
+        const float ry = 0.5f * (db.y0 + db.y1) - track.cy;
+        const float dt = static_cast<float>(track.frames);
+
+        track.cx += kAlpha * rx;
+        track.cy += kAlpha * ry;
+        track.vx += (kBeta / dt) * rx;
+        track.vy += (kBeta / dt) * ry;
+        track.w  += kAlpha * ((db.x1 - db.x0) - track.w);
+        track.h  += kAlpha * ((db.y1 - db.y0) - track.h);
+        track.frames = 0;
+        track.misses = 0;
+
+        trackMatched[bestTrack] = true;
+        detMatched[bestDet]     = true;
+    }
+
+    /* Remove tracks which were not detected for too long */
+    for (size_t t = m_count; t > 0; t--) {
+        if (!trackMatched[t - 1] && (++m_tracks[t - 1].misses > APP_TRACKER_MAX_MISSES)) {
+            m_tracks[t - 1] = m_tracks[--m_count];
+        }
+    }
+
+    /* Start new tracks for unmatched detections */
+    for (size_t d = 0; (d < numDet) && (m_count < APP_TRACKER_MAX_TRACKS); d++) {
+        if (detMatched[d]) {
+            continue;
+        }
+        const Box db = detection_box(detections[d]);
+        TrackedObject& track = m_tracks[m_count++];
+
+        track.id     = m_nextId++;
+        track.cx     = 0.5f * (db.x0 + db.x1);
+        track.cy     = 0.5f * (db.y0 + db.y1);
+        track.w      = db.x1 - db.x0;
+        track.h      = db.y1 - db.y0;
+        track.vx     = 0.0f;
+        track.vy     = 0.0f;
+        track.frames = 0;
+        track.misses = 0;
+    }
+}
+
+size_t ObjectTracker::GetCount() const
+{
+    return m_count;
+}
+
+const TrackedObject& ObjectTracker::GetTrack(size_t idx) const
+{
+    return m_tracks[idx];
+}
+
+void ObjectTracker::GetBox(size_t idx, uint32_t& x0, uint32_t& y0, uint32_t& w, uint32_t& h) const
+{
+    Box b = track_box(m_tracks[idx]);
+
+    b.x0 = (b.x0 < 0.0f) ? 0.0f : ((b.x0 > m_imgWidth)  ? m_imgWidth  : b.x0);
+    b.y0 = (b.y0 < 0.0f) ? 0.0f : ((b.y0 > m_imgHeight) ? m_imgHeight : b.y0);
+    b.x1 = (b.x1 < b.x0) ? b.x0 : ((b.x1 > m_imgWidth)  ? m_imgWidth  : b.x1);
+    b.y1 = (b.y1 < b.y0) ? b.y0 : ((b.y1 > m_imgHeight) ? m_imgHeight : b.y1);
+
+    x0 = static_cast<uint32_t>(b.x0 + 0.5f);
+    y0 = static_cast<uint32_t>(b.y0 + 0.5f);
+    w  = static_cast<uint32_t>(b.x1 + 0.5f) - x0;
+    h  = static_cast<uint32_t>(b.y1 + 0.5f) - y0;
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its
+ * affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StageProfiler.hpp"
+
+#if (APP_PROFILE != 0)
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "cmsis_os2.h"
+
+/* Statistics of a stage */
+enum ProfileStat {
+    STAT_MIN = 0,
+    STAT_AVG,
+    STAT_MAX,
+    STAT_P95,
+    STAT_COUNT
+};
+
+/* Stage names (PerformanceResults.md column headers) */
+static const char* const stageName[PROFILE_STAGE_COUNT] = {
+    "prepare frame for ML",
+    "pre-processing",
+    "inference",
+    "post-processing",
+    "display frame with results"
+};
+
+/* Statistic names */
+static const char* const statName[STAT_COUNT] = {"min", "avg", "max", "p95"};
+
+/**
+ * @brief   Gets the current cycle count, the kernel system timer is used
+ *          on cores without the DWT cycle counter.
+ */
+static inline uint32_t profile_counter()
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    return DWT->CYCCNT;
+#else
+    return osKernelGetSysTimerCount();
+#endif
+}
+
+/**
+ * @brief   Gets the frequency of the counter returned by profile_counter.
+ */
+static inline uint32_t profile_counter_freq()
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    return SystemCoreClock;
+#else
+    return osKernelGetSysTimerFreq();
+#endif
+}
+
+StageProfiler::StageProfiler()
+    : m_samples{},
+      m_count{},
+      m_start{},
+      m_images{0}
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    /* Enable the DWT cycle counter */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void StageProfiler::Start(ProfileStage stage)
+{
+    m_start[stage] = profile_counter();
+}
+
+void StageProfiler::Stop(ProfileStage stage)
+{
+    /* Oldest sample of the window is replaced */
+    m_samples[stage][m_count[stage] % APP_PROFILE_WINDOW] = profile_counter() - m_start[stage];
+    m_count[stage]++;
+}
+
+void StageProfiler::EndImage()
+{
+    if (++m_images >= APP_PROFILE_INTERVAL) {
+        m_images = 0;
+        PrintSummary();
+    }
+}
+
+void StageProfiler::PrintSummary() const
+{
+    static uint32_t sorted[APP_PROFILE_WINDOW];
+    uint32_t stat[PROFILE_STAGE_COUNT][STAT_COUNT] = {};
+    uint32_t num[PROFILE_STAGE_COUNT];
+
+    for (uint32_t s = 0; s < PROFILE_STAGE_COUNT; s++) {
+        num[s] = std::min<uint32_t>(m_count[s], APP_PROFILE_WINDOW);
+        if (num[s] == 0) {
+            continue;
+        }
+
+        uint64_t sum = 0;
+        std::copy(m_samples[s], m_samples[s] + num[s], sorted);
+        for (uint32_t i = 0; i < num[s]; i++) {
+            sum += sorted[i];
+        }
+
+        /* Nearest rank 95th percentile */
+        const uint32_t rank = (num[s] * 95U + 99U) / 100U - 1U;
+        std::nth_element(sorted, sorted + rank, sorted + num[s]);
+
+        stat[s][STAT_MIN] = *std::min_element(sorted, sorted + num[s]);
+        stat[s][STAT_AVG] = static_cast<uint32_t>(sum / num[s]);
+        stat[s][STAT_MAX] = *std::max_element(sorted, sorted + num[s]);
+        stat[s][STAT_P95] = sorted[rank];
+    }
+
+    /* Table with the layout of PerformanceResults.md, times in milliseconds */
+    const uint64_t freq = profile_counter_freq();
+
+    printf("Stage profile (%" PRIu32 " Hz counter, last %" PRIu32 " samples per stage):\n",
+           static_cast<uint32_t>(freq), static_cast<uint32_t>(APP_PROFILE_WINDOW));
+    printf("|     ");
+    for (uint32_t s = 0; s < PROFILE_STAGE_COUNT; s++) {
+        printf("| **%s** ", stageName[s]);
+    }
+    printf("|\n|-----");
+    for (uint32_t s = 0; s < PROFILE_STAGE_COUNT; s++) {
+        printf("|---");
+    }
+    printf("|\n");
+
+    for (uint32_t t = 0; t < STAT_COUNT; t++) {
+        printf("| %s ", statName[t]);
+        for (uint32_t s = 0; s < PROFILE_STAGE_COUNT; s++) {
+            if (num[s] == 0) {
+                printf("| - ");
+                continue;
+            }
+            const uint32_t us = static_cast<uint32_t>((stat[s][t] * 1000000ULL) / freq);
+            printf("| %" PRIu32 ".%03" PRIu32 "ms ", us / 1000U, us % 1000U);
+        }
+        printf("|\n");
+    }
+}
+
+#endif /* APP_PROFILE != 0 */
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "VideoSource.hpp"
 
@@ -37,9 +38,47 @@ static const size_t img_array_sizes[NUMBER_OF_FILES] = {
     110592U,
 };
 
+/* Sample images are RGB888 at model input resolution */
+#define IMG_BYTES_PER_PIXEL (3U)
+
+/* Model input buffer provided by the application */
+static uint8_t*     input_buf    = nullptr;
+static uint32_t     input_size   = 0U;
+static img_layout_t input_layout = IMG_LAYOUT_RGB888;
+static bool         input_signed = false;
+
+/* Images counted by the change gate */
+static uint32_t img_processed = 0U;
+
+/*
+  Convert a sample image into the model input buffer.
+
+  \param[in]  idx  Image index.
+*/
+static void write_input(const uint32_t idx)
+{
+    const uint8_t  mask   = input_signed ? 0x80U : 0x00U;
+    const uint8_t* src    = img_arrays[idx];
+    const uint32_t pixels = img_array_sizes[idx] / IMG_BYTES_PER_PIXEL;
+
+    if (input_layout == IMG_LAYOUT_GRAYSCALE) {
+        for (uint32_t i = 0; i < pixels; ++i, src += IMG_BYTES_PER_PIXEL) {
+            const uint32_t y = (77U * src[0]) + (150U * src[1]) + (29U * src[2]);
+            input_buf[i] = static_cast<uint8_t>(y >> 8) ^ mask;
+        }
+    } else {
+        for (uint32_t i = 0; i < img_array_sizes[idx]; ++i) {
+            input_buf[i] = src[i] ^ mask;
+        }
+    }
+}
+
 bool open_img_source(const uint32_t idx)
 {
     if(idx < NUMBER_OF_FILES) {
+        if (input_buf != nullptr) {
+            write_input(idx);
+        }
         return true;
     }
     return false;
@@ -61,7 +100,7 @@ const char* get_img_name(const uint32_t idx)
 const uint8_t* get_img_array(const uint32_t idx)
 {
     if (idx < NUMBER_OF_FILES) {
-        return img_arrays[idx];
+        return (input_buf != nullptr) ? input_buf : img_arrays[idx];
     }
     return nullptr;
 }
@@ -70,7 +109,7 @@ uint32_t get_img_array_size(const uint32_t idx)
 {
     /* Return image array size in bytes */
     if (idx < NUMBER_OF_FILES) {
-        return img_array_sizes[idx];
+        return (input_buf != nullptr) ? input_size : img_array_sizes[idx];
     }
     return 0U;
 }
@@ -82,4 +121,94 @@ void set_img_object_box(const uint32_t idx, const uint32_t x0, const uint32_t y0
     (void)y0;
     (void)w;
     (void)h;
-}
\ No newline at end of file
+}
+
+bool set_img_input_buffer(void *data, const uint32_t size, const img_layout_t layout, const bool is_signed)
+{
+    const uint32_t bpp    = (layout == IMG_LAYOUT_GRAYSCALE) ? 1U : IMG_BYTES_PER_PIXEL;
+    const uint32_t needed = (img_array_sizes[0] / IMG_BYTES_PER_PIXEL) * bpp;
+
+    if ((layout != IMG_LAYOUT_RGB888) && (layout != IMG_LAYOUT_GRAYSCALE)) {
+        return false;
+    }
+    if ((data == nullptr) || (size < needed)) {
+        return false;
+    }
+
+    /* Sample images are converted into the model input when opened */
+    input_buf    = static_cast<uint8_t*>(data);
+    input_size   = needed;
+    input_layout = layout;
+    input_signed = is_signed;
+    return true;
+}
+
+uint32_t get_img_dropped_count(void)
+{
+    /* Images are read from memory, no image is ever dropped */
+    return 0;
+}
+
+bool get_img_changed(const uint32_t idx)
+{
+    (void)idx;
+
+    /* Images are unrelated to each other, each one is processed */
+    return true;
+}
+
+void set_img_inferred(const uint32_t idx)
+{
+    (void)idx;
+
+    img_processed++;
+}
+
+void get_img_gate_counts(uint32_t *processed, uint32_t *skipped)
+{
+    *processed = img_processed;
+    *skipped   = 0U;
+}
+
+bool read_img_source(const uint32_t idx, uint8_t *dst, const uint32_t size)
+{
+    if ((idx < NUMBER_OF_FILES) && (dst != nullptr) && (size >= img_array_sizes[idx])) {
+        memcpy(dst, img_arrays[idx], img_array_sizes[idx]);
+        return true;
+    }
+    return false;
+}
+
+bool open_img_display(const uint32_t idx, const uint8_t *img)
+{
+    (void)idx;
+
+    /* There is no display, image is accepted as is */
+    return (img != nullptr);
+}
+
+void set_img_display_enabled(const bool enable)
+{
+    /* There is no display */
+    (void)enable;
+}
+
+bool set_img_resolution_reduced(const bool reduced)
+{
+    /* Sample images are stored at ML image resolution */
+    return !reduced;
+}
+
+bool read_img_roi(const uint32_t idx, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h,
+                  img_roi_t *roi)
+{
+    (void)idx;
+    (void)x0;
+    (void)y0;
+    (void)w;
+    (void)h;
+    (void)roi;
+
+    /* Sample images are stored at ML image resolution, there is no finer detail */
+    return false;
+}
@@ -38,22 +38,169 @@ extern vStreamDriver_t          Driver_vStreamVideoIn;
 extern vStreamDriver_t          Driver_vStreamVideoOut;
 #define vStream_VideoOut      (&Driver_vStreamVideoOut)
 
-/* Camera frame buffer (RAW8 or RGB565) */
-static uint8_t CAM_Frame[CAMERA_FRAME_SIZE] CAMERA_FRAME_BUF_ATTRIBUTE;
+/* Camera frame buffer (ring of CAMERA_FRAME_BUF_COUNT frames) */
+static uint8_t CAM_Frame[CAMERA_FRAME_BUF_COUNT * CAMERA_FRAME_SIZE] CAMERA_FRAME_BUF_ATTRIBUTE;
 
+#if (ML_INPUT_DIRECT == 0)
 /* RGB image buffer (RGB888) */
 static uint8_t RGB_Image[RGB_IMAGE_SIZE] RGB_IMAGE_BUF_ATTRIBUTE;
+#endif
 
-/* ML image buffer (RGB888) */
-static uint8_t ML_Image[ML_IMAGE_SIZE] ML_IMAGE_BUF_ATTRIBUTE;
+/* Model input buffer (RGB888 or grayscale, uint8 or int8), provided by the application */
+static uint8_t        *ML_Input        = NULL;
+static uint32_t        ML_Input_Size   = 0U;
+static image_format_t  ML_Input_Format = IMAGE_FORMAT_RGB888;
+static bool            ML_Input_Signed = false;
 
-/* Display frame buffer (RGB888) */
-static uint8_t LCD_Frame[DISPLAY_IMAGE_SIZE] DISPLAY_FRAME_BUF_ATTRIBUTE;
+/* Display frame buffer acquired for the current frame */
+static uint8_t *Display_Frame = NULL;
 
-static void DrawBox(uint8_t *imageData, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h);
+/* Images are shown on the display */
+static bool Display_Enabled = true;
+
+/* ML image copy into the display frame is in progress */
+static volatile bool Display_Blit_Pending = false;
+
+/* Display frame buffer (RGB888, ring of DISPLAY_FRAME_BUF_COUNT frames) */
+static uint8_t LCD_Frame[DISPLAY_FRAME_BUF_COUNT * DISPLAY_IMAGE_SIZE] DISPLAY_FRAME_BUF_ATTRIBUTE;
+
+/* Area of the display frame showing the ML image, centered */
+#define DISPLAY_IMAGE_X       ((DISPLAY_FRAME_WIDTH  - ML_IMAGE_WIDTH)  / 2)
+#define DISPLAY_IMAGE_Y       ((DISPLAY_FRAME_HEIGHT - ML_IMAGE_HEIGHT) / 2)
+#define DISPLAY_IMAGE_WIDTH   ML_IMAGE_WIDTH
+#define DISPLAY_IMAGE_HEIGHT  ML_IMAGE_HEIGHT
+
+/* Rectangle in display frame coordinates (x1 and y1 are exclusive) */
+struct Display_Rect {
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+};
+
+/* Overlay area drawn into each display frame (dirty rectangle) */
+static Display_Rect Overlay_Dirty[DISPLAY_FRAME_BUF_COUNT];
+
+#if defined(CAMERA_FRAME_YUV)
+/* YUV 4:2:0 layout of the camera frame */
+#if   (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_YUV420)
+#define CAMERA_FRAME_YUV_FORMAT  YUV_FORMAT_I420
+#elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_NV12)
+#define CAMERA_FRAME_YUV_FORMAT  YUV_FORMAT_NV12
+#else
+#define CAMERA_FRAME_YUV_FORMAT  YUV_FORMAT_NV21
+#endif
+
+/* Camera frame area shown in the RGB image, whole square frame or center crop */
+#if (CAMERA_FRAME_WIDTH == CAMERA_FRAME_HEIGHT)
+#define YUV_CROP_X            0
+#define YUV_CROP_Y            0
+#define YUV_CROP_WIDTH        CAMERA_FRAME_WIDTH
+#define YUV_CROP_HEIGHT       CAMERA_FRAME_HEIGHT
+#else
+#define YUV_CROP_X            ((CAMERA_FRAME_WIDTH  - RGB_IMAGE_WIDTH)  / 2)
+#define YUV_CROP_Y            ((CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2)
+#define YUV_CROP_WIDTH        RGB_IMAGE_WIDTH
+#define YUV_CROP_HEIGHT       RGB_IMAGE_HEIGHT
+#endif
+#endif
+
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+#if (ML_INPUT_DIRECT == 0)
+/* Camera frame is cropped and debayered into RGB image buffer */
+#define DEBAYER_OUT_WIDTH   RGB_IMAGE_WIDTH
+#define DEBAYER_OUT_HEIGHT  RGB_IMAGE_HEIGHT
+#else
+/* Camera frame is cropped and debayered directly into model input */
+#define DEBAYER_OUT_WIDTH   ML_IMAGE_WIDTH
+#define DEBAYER_OUT_HEIGHT  ML_IMAGE_HEIGHT
+#endif
+
+/* Sampling plan for cropping and debayering camera frame */
+static crop_and_debayer_plan_t Debayer_Plan;
+static uint16_t Debayer_Plan_Buf[CROP_AND_DEBAYER_PLAN_BUF_SIZE(DEBAYER_OUT_WIDTH, DEBAYER_OUT_HEIGHT)];
+
+#if (ML_INPUT_DIRECT == 0)
+/* Reduced resolution: the RGB image crop is debayered directly at ML image size */
+static bool Resolution_Reduced = false;
+static crop_and_debayer_plan_t Reduced_Plan;
+static uint16_t Reduced_Plan_Buf[CROP_AND_DEBAYER_PLAN_BUF_SIZE(ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT)];
+#endif
+#endif
+
+#if (ML_INPUT_DIRECT == 0)
+/* Integer factor between RGB and ML image size (0 when ratio is not 2, 4 or 8) */
+#if   (RGB_IMAGE_WIDTH == ML_IMAGE_WIDTH * 2) && (RGB_IMAGE_HEIGHT == ML_IMAGE_HEIGHT * 2)
+#define ML_DECIMATION_FACTOR  2
+#elif (RGB_IMAGE_WIDTH == ML_IMAGE_WIDTH * 4) && (RGB_IMAGE_HEIGHT == ML_IMAGE_HEIGHT * 4)
+#define ML_DECIMATION_FACTOR  4
+#elif (RGB_IMAGE_WIDTH == ML_IMAGE_WIDTH * 8) && (RGB_IMAGE_HEIGHT == ML_IMAGE_HEIGHT * 8)
+#define ML_DECIMATION_FACTOR  8
+#else
+#define ML_DECIMATION_FACTOR  0
+#endif
+
+#if (ML_DECIMATION_FACTOR == 0)
+/* Sampling plan for resizing RGB image to ML image */
+static image_resize_plan_t Resize_Plan;
+static uint16_t Resize_Plan_Buf[IMAGE_RESIZE_PLAN_BUF_SIZE(ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT)];
+#endif
+#endif
+
+#if (MOTION_GATE != 0)
+/* Luma thumbnail used for scene change detection */
+#define MOTION_THUMB_FACTOR   8
+#define MOTION_THUMB_SIZE     ((ML_IMAGE_WIDTH / MOTION_THUMB_FACTOR) * (ML_IMAGE_HEIGHT / MOTION_THUMB_FACTOR))
+
+/* Thumbnails of the current image and of the last image passed to the model */
+static uint8_t  Motion_Thumb[MOTION_THUMB_SIZE];
+static uint8_t  Motion_Thumb_Ref[MOTION_THUMB_SIZE];
+static bool     Motion_Thumb_Ref_Valid = false;
+
+/* Consecutive images since the last inferred image */
+static uint32_t Motion_Skip_Run = 0U;
+#endif
+
+#if (ROI_REINFER != 0)
+/* Camera frame area shown in the ML image (center crop) */
+#define ML_SOURCE_X           ((CAMERA_FRAME_WIDTH  - RGB_IMAGE_WIDTH)  / 2)
+#define ML_SOURCE_Y           ((CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2)
+
+/* Camera frame of the open image, held for region of interest crops */
+static uint8_t *ROI_Frame = NULL;
+
+/* Sampling plan for cropping a region of interest from the camera frame */
+static crop_and_debayer_plan_t ROI_Plan;
+static uint16_t ROI_Plan_Buf[CROP_AND_DEBAYER_PLAN_BUF_SIZE(ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT)];
+#endif
+
+/* Images passed to the model and images found unchanged by the change gate */
+static uint32_t Gate_Processed = 0U;
+static uint32_t Gate_Skipped   = 0U;
+
+static void init_plans(void);
+static uint8_t *open_camera_frame(void);
+static uint8_t *get_camera_frame(void);
+static void convert_frame_to_ml(uint8_t *inFrame, uint8_t *outImage, const image_format_t format, const int is_signed);
+static void overlay_fill(uint8_t *outFrame, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+static void overlay_clear(uint8_t *outFrame);
+static void overlay_box(uint8_t *outFrame, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h);
+static bool open_display(void);
+static uint8_t *get_display_frame(void);
+static void wait_display_idle(void);
+static void start_display_blit(uint8_t *outFrame, const uint8_t *image);
+static void wait_display_blit(void);
+static void copy_input_to_display(uint8_t *outFrame);
+#if (ML_INPUT_DIRECT == 0)
 static void convert_frame_to_rgb(uint8_t *inFrame);
+#endif
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+static void debayer_frame_to_ml(const crop_and_debayer_plan_t *plan, uint8_t *inFrame, uint8_t *outImage,
+                                const image_format_t format, const int is_signed);
+#endif
 
 osThreadId_t tid_app_main = NULL;
+osThreadId_t tid_display  = NULL;
 
 uint8_t VideoIn_Ready = 0U;
 uint8_t VideoOut_Ready = 0U;
@@ -61,14 +208,26 @@ uint8_t VideoOut_Ready = 0U;
 uint32_t EventCnt_VideoIn = 0U;
 uint32_t EventCnt_VideoOut = 0U;
 
+/* Camera frames captured (written by event callback) and taken by the application */
+static volatile uint32_t CAM_Frames_Captured = 0U;
+static uint32_t          CAM_Frames_Taken    = 0U;
+
+/* Camera frames that were captured or lost without being processed */
+static volatile uint32_t CAM_Frames_Dropped  = 0U;
+
 /* Video In Stream Event Callback */
 void VideoIn_Event_Callback (uint32_t event) {
     (void)event;
 
     if (event & VSTREAM_EVENT_DATA) {
         /* Video frame is available in camera frame buffer */
+        CAM_Frames_Captured++;
         osThreadFlagsSet(tid_app_main, 0x1);
     }
+    if (event & VSTREAM_EVENT_OVERFLOW) {
+        /* No free frame in the ring, camera frame was lost */
+        CAM_Frames_Dropped++;
+    }
     EventCnt_VideoIn++;
 }
 
@@ -76,202 +235,822 @@ void VideoIn_Event_Callback (uint32_t event) {
 void VideoOut_Event_Callback (uint32_t event) {
     (void)event;
 
+    if (event & VSTREAM_EVENT_DATA) {
+        /* Display frame was sent and its buffer is free */
+        if (tid_display != NULL) {
+            osThreadFlagsSet(tid_display, 0x4);
+        }
+    }
     EventCnt_VideoOut++;
 }
 
 bool open_img_source(const uint32_t idx)
 {
     uint8_t *inFrame;
+
+    if (ML_Input == NULL) {
+        printf_err("Model input buffer is not set\n");
+        return false;
+    }
+
+    /* Get the latest captured frame */
+    inFrame = open_camera_frame();
+    if (inFrame == NULL) {
+        return false;
+    }
+
+    /* Convert input frame directly into the model input buffer */
+    convert_frame_to_ml(inFrame, ML_Input, ML_Input_Format, ML_Input_Signed ? 1 : 0);
+#if (MOTION_GATE != 0)
+    image_luma_thumbnail(ML_Input, ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, ML_Input_Format,
+                         Motion_Thumb, MOTION_THUMB_FACTOR, ML_Input_Signed ? 1 : 0);
+#endif
+
+    /* Model input may be overwritten during inference, place it into the display frame now */
+    Display_Frame = Display_Enabled ? get_display_frame() : NULL;
+    if (Display_Frame != NULL) {
+        overlay_clear(Display_Frame);
+        copy_input_to_display(Display_Frame);
+    }
+
+#if (ROI_REINFER != 0)
+    /* Keep input frame for region of interest crops, it is released when the image is closed */
+    ROI_Frame = inFrame;
+#else
+    /* Release input frame, so the camera can capture into it while the model runs */
+    if (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK) {
+        printf_err("Failed to release video input frame\n");
+    }
+#endif
+
+    return true;
+}
+
+bool read_img_source(const uint32_t idx, uint8_t *dst, const uint32_t size)
+{
+    uint8_t *inFrame;
+
+    if ((dst == NULL) || (size < ML_IMAGE_SIZE)) {
+        printf_err("Invalid image buffer\n");
+        return false;
+    }
+
+    /* Get the latest captured frame */
+    inFrame = open_camera_frame();
+    if (inFrame == NULL) {
+        return false;
+    }
+
+    /* Convert input frame into the caller's buffer (RGB888) */
+    convert_frame_to_ml(inFrame, dst, IMAGE_FORMAT_RGB888, 0);
+#if (MOTION_GATE != 0)
+    image_luma_thumbnail(dst, ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, IMAGE_FORMAT_RGB888,
+                         Motion_Thumb, MOTION_THUMB_FACTOR, 0);
+#endif
+
+    /* Release input frame, so the camera can capture into it */
+    if (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK) {
+        printf_err("Failed to release video input frame\n");
+    }
+
+    return true;
+}
+
+bool open_img_display(const uint32_t idx, const uint8_t *img)
+{
+    if (img == NULL) {
+        return false;
+    }
+
+    /* Start copying the image into the display frame */
+    Display_Frame = get_display_frame();
+    if (Display_Frame == NULL) {
+        return false;
+    }
+    overlay_clear(Display_Frame);
+    start_display_blit(Display_Frame, img);
+
+    return true;
+}
+
+void close_img_source(const uint32_t idx)
+{
     uint8_t *outFrame;
-    vStreamStatus_t status;
 
+#if (ROI_REINFER != 0)
+    /* Release input frame held for region of interest crops */
+    if (ROI_Frame != NULL) {
+        ROI_Frame = NULL;
+        if (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK) {
+            printf_err("Failed to release video input frame\n");
+        }
+    }
+#endif
+
+    /* Display frame must be complete before it is released */
+    wait_display_blit();
+
+    /* Display frame was composed when the image source was opened */
+    outFrame = Display_Frame;
+    Display_Frame = NULL;
+    if (outFrame == NULL) {
+        return;
+    }
+
+    /* Release output frame */
+    if (vStream_VideoOut->ReleaseBlock() != VSTREAM_OK) {
+        printf_err("Failed to release video output frame\n");
+    }
+
+    /* Frames are sent one at a time, wait until the previous frame is sent */
+    wait_display_idle();
+
+    /* Start video output */
+    if (vStream_VideoOut->Start(VSTREAM_MODE_SINGLE) != VSTREAM_OK) {
+        printf_err("Failed to start video output\n");
+    }
+}
+
+const char* get_filename(const uint32_t idx)
+{
+    return "Live Video Stream";
+}
+
+const uint8_t* get_img_array(const uint32_t idx)
+{
+    /* Image is written into the model input buffer */
+    return ML_Input;
+}
+
+uint32_t get_img_array_size(const uint32_t idx)
+{
+    /* Return image array size in bytes */
+    return ML_Input_Size;
+}
+
+void set_img_object_box(const uint32_t idx, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h) {
+    /* Draw a box around detected object */
+
+    /* Box must not be overwritten by the ML image copy */
+    wait_display_blit();
+    if (Display_Frame != NULL) {
+        /* Draw directly into the display frame, the ML image stays untouched */
+        overlay_box(Display_Frame, x0, y0, w, h);
+    }
+}
+
+bool set_img_input_buffer(void *data, const uint32_t size, const img_layout_t layout, const bool is_signed)
+{
+    const uint32_t bpp = (layout == IMG_LAYOUT_GRAYSCALE) ? 1U : 3U;
+
+    if ((layout != IMG_LAYOUT_RGB888) && (layout != IMG_LAYOUT_GRAYSCALE)) {
+        printf_err("Unsupported model input layout\n");
+        return false;
+    }
+    if ((data == NULL) || (size < (ML_IMAGE_WIDTH * ML_IMAGE_HEIGHT * bpp))) {
+        printf_err("Invalid model input buffer\n");
+        return false;
+    }
+
+    ML_Input        = (uint8_t *)data;
+    ML_Input_Size   = ML_IMAGE_WIDTH * ML_IMAGE_HEIGHT * bpp;
+    ML_Input_Format = (layout == IMG_LAYOUT_GRAYSCALE) ? IMAGE_FORMAT_GRAYSCALE : IMAGE_FORMAT_RGB888;
+    ML_Input_Signed = is_signed;
+
+    /* Model input is written directly, pre-processing is not required */
+    return true;
+}
+
+bool read_img_roi(const uint32_t idx, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h,
+                  img_roi_t *roi)
+{
+#if (ROI_REINFER != 0)
+    /* Camera pixels per ML image pixel */
+    const float src_scale_x = (float)RGB_IMAGE_WIDTH  / ML_IMAGE_WIDTH;
+    const float src_scale_y = (float)RGB_IMAGE_HEIGHT / ML_IMAGE_HEIGHT;
+
+    if ((ROI_Frame == NULL) || (ML_Input == NULL) || (roi == NULL)) {
+        return false;
+    }
+
+    /* Camera pixels per crop pixel, so that the box and its margin fill the crop */
+    const float margin = 1.0f + (ROI_REINFER_MARGIN / 100.0f);
+    const float kx = (w * src_scale_x * margin) / ML_IMAGE_WIDTH;
+    const float ky = (h * src_scale_y * margin) / ML_IMAGE_HEIGHT;
+    float k = (kx > ky) ? kx : ky;
+
+    /* Camera frame is not sampled finer than its native resolution */
+    k = (k < 1.0f) ? 1.0f : k;
+    if (k >= src_scale_x) {
+        /* Crop would not be sharper than the ML image */
+        return false;
+    }
+
+    /* Window centered on the box, kept inside the camera frame */
+    const int32_t win_w = (int32_t)(k * ML_IMAGE_WIDTH  + 0.5f);
+    const int32_t win_h = (int32_t)(k * ML_IMAGE_HEIGHT + 0.5f);
+    const float   cx    = ML_SOURCE_X + (x0 + 0.5f * w) * src_scale_x;
+    const float   cy    = ML_SOURCE_Y + (y0 + 0.5f * h) * src_scale_y;
+    int32_t win_x = (int32_t)(cx - 0.5f * win_w);
+    int32_t win_y = (int32_t)(cy - 0.5f * win_h);
+
+    win_x = (win_x < 0) ? 0 : ((win_x > CAMERA_FRAME_WIDTH  - win_w) ? (CAMERA_FRAME_WIDTH  - win_w) : win_x);
+    win_y = (win_y < 0) ? 0 : ((win_y > CAMERA_FRAME_HEIGHT - win_h) ? (CAMERA_FRAME_HEIGHT - win_h) : win_y);
+
+    /* Crop, debayer and scale the window into the model input buffer */
+    crop_and_debayer_window_plan_init(&ROI_Plan,
+                                      ROI_Plan_Buf,
+                                      CAMERA_FRAME_WIDTH,
+                                      CAMERA_FRAME_HEIGHT,
+                                      win_x,
+                                      win_y,
+                                      win_w,
+                                      win_h,
+                                      ML_IMAGE_WIDTH,
+                                      ML_IMAGE_HEIGHT);
+    debayer_frame_to_ml(&ROI_Plan, ROI_Frame, ML_Input, ML_Input_Format, ML_Input_Signed ? 1 : 0);
+
+    /* Map crop coordinates back to the ML image */
+    roi->x0    = (win_x - ML_SOURCE_X) / src_scale_x;
+    roi->y0    = (win_y - ML_SOURCE_Y) / src_scale_y;
+    roi->scale = ((float)(win_w - 1) / (ML_IMAGE_WIDTH - 1)) / src_scale_x;
+
+    return true;
+#else
+    (void)idx;
+    (void)x0;
+    (void)y0;
+    (void)w;
+    (void)h;
+    (void)roi;
+
+    return false;
+#endif
+}
+
+void set_img_display_enabled(const bool enable)
+{
+    Display_Enabled = enable;
+}
+
+bool set_img_resolution_reduced(const bool reduced)
+{
+#if (ML_INPUT_DIRECT == 0) && (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+    Resolution_Reduced = reduced;
+    return true;
+#else
+    /* Frame is already converted at ML image size, or conversion has no reduced variant */
+    return !reduced;
+#endif
+}
+
+uint32_t get_img_dropped_count(void)
+{
+    return CAM_Frames_Dropped;
+}
+
+bool get_img_changed(const uint32_t idx)
+{
+    bool changed = true;
+
+#if (MOTION_GATE != 0)
+    /* Compare with the last inferred image, unless too many images were skipped */
+    if (Motion_Thumb_Ref_Valid && (Motion_Skip_Run < MOTION_GATE_MAX_SKIP)) {
+        const uint32_t sad = image_sad(Motion_Thumb, Motion_Thumb_Ref, MOTION_THUMB_SIZE);
+        changed = (sad > (MOTION_GATE_THRESHOLD * MOTION_THUMB_SIZE));
+    }
+
+    /* Images since the last inferred image, the reference is updated by set_img_inferred */
+    Motion_Skip_Run++;
+#endif
+
+    if (!changed) {
+        Gate_Skipped++;
+    }
+    return changed;
+}
+
+void set_img_inferred(const uint32_t idx)
+{
+    (void)idx;
+
+#if (MOTION_GATE != 0)
+    /* Inferred image becomes the reference of the change gate */
+    memcpy(Motion_Thumb_Ref, Motion_Thumb, MOTION_THUMB_SIZE);
+    Motion_Thumb_Ref_Valid = true;
+    Motion_Skip_Run = 0U;
+#endif
+
+    Gate_Processed++;
+}
+
+void get_img_gate_counts(uint32_t *processed, uint32_t *skipped)
+{
+    *processed = Gate_Processed;
+    *skipped   = Gate_Skipped;
+}
+
+/*
+  Initialize video input stream if needed and get the latest camera frame.
+
+  The camera frame is bound to the calling thread, which must release it.
+
+  \return pointer to the camera frame buffer or NULL on error.
+*/
+static uint8_t *open_camera_frame(void)
+{
     tid_app_main = osThreadGetId();
 
     if (VideoIn_Ready == 0U) {
         /* Initialize Video Input Stream */
         if (vStream_VideoIn->Initialize(VideoIn_Event_Callback) != VSTREAM_OK) {
             printf_err("Failed to initialise video input driver\n");
-            return false;
+            return NULL;
         }
 
         /* Set Input Video buffer */
         if (vStream_VideoIn->SetBuf(CAM_Frame, sizeof(CAM_Frame), CAMERA_FRAME_SIZE) != VSTREAM_OK) {
             printf_err("Failed to set buffer for video input\n");
-            return false;
+            return NULL;
         }
 
+        /* Precompute sampling plans for fixed frame geometry */
+        init_plans();
+
         VideoIn_Ready = 1U;
     }
 
+    return get_camera_frame();
+}
+
+/*
+  Convert camera frame to ML image.
+
+  A YUV camera frame is converted to a grayscale ML image from its luma
+  plane only, without the RGB image.
+
+  \param[in]  inFrame    Pointer to the camera frame.
+  \param[out] outImage   Pointer to the ML image buffer.
+  \param[in]  format     ML image format (RGB888 or GRAYSCALE).
+  \param[in]  is_signed  Non-zero to store pixels as int8.
+*/
+static void convert_frame_to_ml(uint8_t *inFrame, uint8_t *outImage, const image_format_t format, const int is_signed)
+{
+#if (ML_INPUT_DIRECT == 0)
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+    if (Resolution_Reduced) {
+        /* Crop and debayer input frame at ML image size, skipping the RGB image */
+        debayer_frame_to_ml(&Reduced_Plan, inFrame, outImage, format, is_signed);
+        return;
+    }
+#elif defined(CAMERA_FRAME_YUV)
+    if (format == IMAGE_FORMAT_GRAYSCALE) {
+        /* Crop and scale the luma plane directly into the ML image, skipping the RGB image */
+        crop_and_resize_yuv420(inFrame,
+                               CAMERA_FRAME_WIDTH,
+                               CAMERA_FRAME_HEIGHT,
+                               YUV_CROP_X,
+                               YUV_CROP_Y,
+                               YUV_CROP_WIDTH,
+                               YUV_CROP_HEIGHT,
+                               outImage,
+                               ML_IMAGE_WIDTH,
+                               ML_IMAGE_HEIGHT,
+                               CAMERA_FRAME_YUV_FORMAT,
+                               IMAGE_FORMAT_GRAYSCALE);
+
+        if (is_signed != 0) {
+            image_to_int8(outImage, ML_IMAGE_WIDTH * ML_IMAGE_HEIGHT);
+        }
+        return;
+    }
+#endif
+
+    /* Convert input frame and place it into RGB_Image buffer */
+    convert_frame_to_rgb(inFrame);
+
+#if (ML_DECIMATION_FACTOR != 0)
+    /* Downscale RGB image by an integer factor to ML model expected size */
+    image_decimate(RGB_Image,
+                   RGB_IMAGE_WIDTH,
+                   RGB_IMAGE_HEIGHT,
+                   outImage,
+                   ML_DECIMATION_FACTOR,
+                   IMAGE_FORMAT_RGB888,
+                   format);
+#else
+    /* Resize RGB image to fit ML model expected size */
+    image_resize_planned(&Resize_Plan,
+                         RGB_Image,
+                         outImage,
+                         IMAGE_FORMAT_RGB888,
+                         format);
+#endif
+
+    if (is_signed != 0) {
+        image_to_int8(outImage, ML_IMAGE_WIDTH * ML_IMAGE_HEIGHT * ((format == IMAGE_FORMAT_GRAYSCALE) ? 1 : 3));
+    }
+#else
+    /* Crop, debayer and scale input frame directly into the ML image */
+    debayer_frame_to_ml(&Debayer_Plan, inFrame, outImage, format, is_signed);
+#endif
+}
+
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+/*
+  Crop, debayer and scale camera frame to ML image using a sampling plan.
+
+  \param[in]  plan       Pointer to the sampling plan (ML image size output).
+  \param[in]  inFrame    Pointer to the camera frame.
+  \param[out] outImage   Pointer to the ML image buffer.
+  \param[in]  format     ML image format (RGB888 or GRAYSCALE).
+  \param[in]  is_signed  Non-zero to store pixels as int8.
+*/
+static void debayer_frame_to_ml(const crop_and_debayer_plan_t *plan, uint8_t *inFrame, uint8_t *outImage,
+                                const image_format_t format, const int is_signed)
+{
+    if (format == IMAGE_FORMAT_GRAYSCALE) {
+        crop_and_debayer_planned_gray(plan, inFrame, outImage, CAMERA_FRAME_BAYER, is_signed);
+    } else {
+        crop_and_debayer_planned(plan, inFrame, outImage, CAMERA_FRAME_BAYER, is_signed);
+    }
+}
+#endif
+
+/*
+  Get camera frame buffer.
+
+  With a single frame buffer, capture of one frame is started and awaited.
+  With a frame ring, the camera captures continuously and the latest captured
+  frame is returned; older captured frames are released and counted as dropped.
+
+  \return pointer to the camera frame buffer or NULL on error.
+*/
+static uint8_t *get_camera_frame(void)
+{
+    uint8_t *inFrame;
+
+#if (CAMERA_FRAME_BUF_COUNT == 1)
     /* Start video capture */
     if (vStream_VideoIn->Start(VSTREAM_MODE_SINGLE) != VSTREAM_OK) {
         printf_err("Failed to start video capture\n");
-        return false;
+        return NULL;
     }
 
-
     /* Wait for new video input frame */
     osThreadFlagsWait(0x1, osFlagsWaitAny, osWaitForever);
+#else
+    /* (Re)start continuous capture, driver stops when the ring overflows */
+    if (vStream_VideoIn->GetStatus().active == 0U) {
+        if (vStream_VideoIn->Start(VSTREAM_MODE_CONTINUOUS) != VSTREAM_OK) {
+            printf_err("Failed to start video capture\n");
+            return NULL;
+        }
+    }
+
+    /* Wait for a captured frame */
+    while (CAM_Frames_Captured == CAM_Frames_Taken) {
+        osThreadFlagsWait(0x1, osFlagsWaitAny, osWaitForever);
+    }
+
+    /* Latest frame wins, skip older frames */
+    while ((CAM_Frames_Captured - CAM_Frames_Taken) > 1U) {
+        if ((vStream_VideoIn->GetBlock() == NULL) || (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK)) {
+            break;
+        }
+        CAM_Frames_Taken++;
+        CAM_Frames_Dropped++;
+    }
+    CAM_Frames_Taken++;
+#endif
 
     /* Get input video frame buffer */
     inFrame = (uint8_t *)vStream_VideoIn->GetBlock();
     if (inFrame == NULL) {
         printf_err("Failed to get video input frame\n");
-        return false;
     }
-
-    /* Convert input frame and place it into RGB_Image buffer */
-    convert_frame_to_rgb(inFrame);
-
-    /* Resize RGB image to fit ML model expected size */
-    image_resize(RGB_Image,
-                 RGB_IMAGE_WIDTH,
-                 RGB_IMAGE_HEIGHT,
-                 (uint8_t *)ML_Image,
-                 ML_IMAGE_WIDTH,
-                 ML_IMAGE_HEIGHT,
-                 IMAGE_FORMAT_RGB888,
-                 IMAGE_FORMAT_RGB888);
-
-    /* Release input frame */
-    if (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK) {
-        printf_err("Failed to release video input frame\n");
-    }
-
-    return true;
+    return inFrame;
 }
 
-void close_img_source(const uint32_t idx)
-{
-    vStreamStatus_t status;
-    uint8_t *outFrame;
+/*
+  Initialize video output stream.
 
+  \return true on success, false otherwise.
+*/
+static bool open_display(void)
+{
     if (VideoOut_Ready == 0U) {
         /* Initialize Video Output Stream */
         if (vStream_VideoOut->Initialize(VideoOut_Event_Callback) != VSTREAM_OK) {
             printf_err("Failed to initialise video output driver\n");
-            return;
+            return false;
         }
 
         /* Set Output Video buffer */
         if (vStream_VideoOut->SetBuf(LCD_Frame, sizeof(LCD_Frame), DISPLAY_IMAGE_SIZE) != VSTREAM_OK) {
             printf_err("Failed to set buffer for video output\n");
-            return;
+            return false;
         }
 
         VideoOut_Ready = 1U;
     }
+    return true;
+}
 
-    /* Wait for video output frame to be released */
-    do {
-        status = vStream_VideoOut->GetStatus();
-    } while (status.active == 1U);
+/*
+  Get display frame buffer.
 
-    /* Get output frame */
-    outFrame = (uint8_t *)vStream_VideoOut->GetBlock();
-    if (outFrame == NULL) {
-        printf_err("Failed to get video output frame\n");
-        return;
+  Initializes the video output stream if needed. With double buffering the
+  free frame is returned while the other frame is sent, otherwise the calling
+  thread sleeps until the output driver releases the frame.
+
+  \return pointer to the display frame buffer or NULL on error.
+*/
+static uint8_t *get_display_frame(void)
+{
+    uint8_t *outFrame;
+
+    if (!open_display()) {
+        return NULL;
     }
 
-    /* Copy ML image into the display frame buffer */
-    image_copy_to_framebuffer(ML_Image,
-                              ML_IMAGE_WIDTH,
-                              ML_IMAGE_HEIGHT,
-                              outFrame,
-                              DISPLAY_FRAME_WIDTH,
-                              DISPLAY_FRAME_HEIGHT,
-                             (DISPLAY_FRAME_WIDTH - ML_IMAGE_WIDTH) / 2,
-                             (DISPLAY_FRAME_HEIGHT - ML_IMAGE_HEIGHT)/2,
-                             IMAGE_FORMAT_RGB888);
+    tid_display = osThreadGetId();
 
-    /* Release output frame */
-    if (vStream_VideoOut->ReleaseBlock() != VSTREAM_OK) {
-        printf_err("Failed to release video output frame\n");
+    /* Get output frame, wait for the output driver if all frames are in use */
+    while ((outFrame = (uint8_t *)vStream_VideoOut->GetBlock()) == NULL) {
+        if (vStream_VideoOut->GetStatus().active == 0U) {
+            printf_err("Failed to get video output frame\n");
+            break;
+        }
+        osThreadFlagsWait(0x4, osFlagsWaitAny, osWaitForever);
     }
+    return outFrame;
+}
 
-    /* Start video output */
-    if (vStream_VideoOut->Start(VSTREAM_MODE_SINGLE) != VSTREAM_OK) {
-        printf_err("Failed to start video output\n");
+/*
+  Wait until the video output is not sending a frame.
+
+  The calling thread sleeps until the output event callback signals that
+  the frame was sent.
+*/
+static void wait_display_idle(void)
+{
+    tid_display = osThreadGetId();
+
+    while (vStream_VideoOut->GetStatus().active == 1U) {
+        osThreadFlagsWait(0x4, osFlagsWaitAny, osWaitForever);
     }
 }
 
-const char* get_filename(const uint32_t idx)
+/*
+  Display blit completion callback, called from DMA interrupt or directly.
+*/
+static void display_blit_done(int status, void *arg)
 {
-    return "Live Video Stream";
+    (void)status;
+    Display_Blit_Pending = false;
+    osThreadFlagsSet((osThreadId_t)arg, 0x2);
 }
 
-const uint8_t* get_img_array(const uint32_t idx)
+/*
+  Start copying ML image into the center of the display frame.
+
+  The copy runs asynchronously when the target provides a DMA, otherwise it
+  completes before this function returns.
+
+  \param[out] outFrame  Pointer to the display frame buffer.
+  \param[in]  image     Pointer to the ML image (RGB888).
+*/
+static void start_display_blit(uint8_t *outFrame, const uint8_t *image)
 {
-    return ML_Image;
+    image_blit_t blit;
+
+    blit.src        = image;
+    blit.src_width  = ML_IMAGE_WIDTH;
+    blit.src_height = ML_IMAGE_HEIGHT;
+    blit.src_stride = ML_IMAGE_WIDTH * 3;
+    blit.dst        = outFrame;
+    blit.dst_width  = DISPLAY_FRAME_WIDTH;
+    blit.dst_height = DISPLAY_FRAME_HEIGHT;
+    blit.dst_stride = DISPLAY_FRAME_WIDTH * 3;
+    blit.dst_x      = DISPLAY_IMAGE_X;
+    blit.dst_y      = DISPLAY_IMAGE_Y;
+    blit.bpp        = 3;
+
+    /* Discard stale completion flag of a previous blit */
+    osThreadFlagsClear(0x2);
+
+    Display_Blit_Pending = true;
+    if (image_blit_async(&blit, display_blit_done, osThreadGetId()) != 0) {
+        /* DMA busy or failed, copy synchronously */
+        Display_Blit_Pending = false;
+        image_blit(&blit);
+    }
 }
 
-uint32_t get_img_array_size(const uint32_t idx)
+/*
+  Wait until the ML image copy into the display frame is complete.
+*/
+static void wait_display_blit(void)
 {
-    /* Return image array size in bytes */
-    return sizeof(ML_Image);
+    while (Display_Blit_Pending) {
+        osThreadFlagsWait(0x2, osFlagsWaitAny, osWaitForever);
+    }
 }
 
-void set_img_object_box(const uint32_t idx, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h) {
-    /* Draw a box around detected object */
-    DrawBox(ML_Image, x0, y0, w, h);
+/*
+  Copy model input into the center of the display frame.
+
+  Grayscale model input is expanded to RGB888, RGB888 model input is
+  blitted. Signed (int8) model input is converted back to uint8. The copy is
+  complete when this function returns, as the model input may be overwritten
+  during inference.
+
+  \param[out] outFrame  Pointer to the display frame buffer.
+*/
+static void copy_input_to_display(uint8_t *outFrame)
+{
+    const uint32_t step = DISPLAY_FRAME_WIDTH * 3;
+    uint8_t       *dst  = outFrame + (DISPLAY_IMAGE_Y * step) + (DISPLAY_IMAGE_X * 3);
+
+    if (ML_Input_Format == IMAGE_FORMAT_GRAYSCALE) {
+        image_gray_to_rgb888(ML_Input, ML_IMAGE_WIDTH, dst, step,
+                             ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, ML_Input_Signed ? 1 : 0);
+        return;
+    }
+
+    start_display_blit(outFrame, ML_Input);
+    wait_display_blit();
+
+    if (ML_Input_Signed) {
+        /* Flipping the sign bit again converts int8 back to uint8 */
+        for (uint32_t y = 0; y < ML_IMAGE_HEIGHT; ++y) {
+            image_to_int8(dst + (y * step), ML_IMAGE_WIDTH * 3);
+        }
+    }
 }
 
-/**
- * @brief Draws a box in the image.
- *
- * @param[out] imageData    Pointer to the start of the image.
- * @param[in]  width        Image width.
- * @param[in]  height       Image height.
- * @param[in]  result       Object detection result.
- */
-static void DrawBox(uint8_t *imageData, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h)
+/*
+  Precompute sampling plans for the fixed camera, RGB and ML image geometry.
+*/
+static void init_plans(void)
 {
-    const uint32_t step = ML_IMAGE_WIDTH * 3;
-    uint8_t* const imStart = imageData + (y0 * step) + (x0 * 3);
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+    crop_and_debayer_plan_init(&Debayer_Plan,
+                               Debayer_Plan_Buf,
+                               CAMERA_FRAME_WIDTH,
+                               CAMERA_FRAME_HEIGHT,
+                               (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
+                               (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
+                               DEBAYER_OUT_WIDTH,
+                               DEBAYER_OUT_HEIGHT);
+#if (ML_INPUT_DIRECT == 0)
+    crop_and_debayer_plan_init(&Reduced_Plan,
+                               Reduced_Plan_Buf,
+                               CAMERA_FRAME_WIDTH,
+                               CAMERA_FRAME_HEIGHT,
+                               (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
+                               (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
+                               ML_IMAGE_WIDTH,
+                               ML_IMAGE_HEIGHT);
+#endif
+#endif
+#if (ML_INPUT_DIRECT == 0) && (ML_DECIMATION_FACTOR == 0)
+    image_resize_plan_init(&Resize_Plan,
+                           Resize_Plan_Buf,
+                           RGB_IMAGE_WIDTH,
+                           RGB_IMAGE_HEIGHT,
+                           ML_IMAGE_WIDTH,
+                           ML_IMAGE_HEIGHT);
+#endif
+}
 
-    uint8_t* dst_0 = imStart;
-    uint8_t* dst_1 = imStart + (h * step);
+/*
+  Fill a rectangle of the display frame, clipped to the frame.
 
-    for (uint32_t i = 0; i < w; ++i) {
-        dst_0[1] = 255;
-        dst_1[1] = 255;
+  \param[out] outFrame  Pointer to the display frame buffer.
+  \param[in]  x0        Left edge.
+  \param[in]  y0        Top edge.
+  \param[in]  x1        Right edge (exclusive).
+  \param[in]  y1        Bottom edge (exclusive).
+  \param[in]  color     Fill color as 0xRRGGBB.
+*/
+static void overlay_fill(uint8_t *outFrame, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (x1 > DISPLAY_FRAME_WIDTH)  ? DISPLAY_FRAME_WIDTH  : x1;
+    y1 = (y1 > DISPLAY_FRAME_HEIGHT) ? DISPLAY_FRAME_HEIGHT : y1;
 
-        dst_0 += 3;
-        dst_1 += 3;
+    if ((x1 > x0) && (y1 > y0)) {
+        image_fill_rgb888(outFrame + (y0 * DISPLAY_FRAME_WIDTH + x0) * 3,
+                          DISPLAY_FRAME_WIDTH * 3,
+                          x1 - x0,
+                          y1 - y0,
+                          color);
     }
+}
+
+/*
+  Clear overlay drawn into the display frame when it was used before.
+
+  The ML image area is overwritten by the next image, so only the parts of
+  the dirty rectangle outside of it are cleared. Must be called before the
+  image copy into the display frame is started.
+
+  \param[out] outFrame  Pointer to the display frame buffer.
+*/
+static void overlay_clear(uint8_t *outFrame)
+{
+    Display_Rect *dirty = &Overlay_Dirty[(outFrame - LCD_Frame) / DISPLAY_IMAGE_SIZE];
+
+    const int32_t ix0 = DISPLAY_IMAGE_X;
+    const int32_t iy0 = DISPLAY_IMAGE_Y;
+    const int32_t ix1 = DISPLAY_IMAGE_X + DISPLAY_IMAGE_WIDTH;
+    const int32_t iy1 = DISPLAY_IMAGE_Y + DISPLAY_IMAGE_HEIGHT;
+
+    if ((dirty->x1 > dirty->x0) && (dirty->y1 > dirty->y0)) {
+        /* Strips above, below, left and right of the image */
+        const int32_t y0 = (dirty->y0 > iy0) ? dirty->y0 : iy0;
+        const int32_t y1 = (dirty->y1 < iy1) ? dirty->y1 : iy1;
+
+        overlay_fill(outFrame, dirty->x0, dirty->y0, dirty->x1, (dirty->y1 < iy0) ? dirty->y1 : iy0, 0U);
+        overlay_fill(outFrame, dirty->x0, (dirty->y0 > iy1) ? dirty->y0 : iy1, dirty->x1, dirty->y1, 0U);
+        overlay_fill(outFrame, dirty->x0, y0, (dirty->x1 < ix0) ? dirty->x1 : ix0, y1, 0U);
+        overlay_fill(outFrame, (dirty->x0 > ix1) ? dirty->x0 : ix1, y0, dirty->x1, y1, 0U);
+    }
+
+    dirty->x0 = 0;
+    dirty->y0 = 0;
+    dirty->x1 = 0;
+    dirty->y1 = 0;
+}
 
-    dst_0 = imStart;
-    dst_1 = imStart + (w * 3);
+/*
+  Draw a box outline into the display frame.
+
+  The box is scaled from ML image to display coordinates, clipped to the
+  display frame and added to the dirty rectangle of the frame.
+
+  \param[out] outFrame  Pointer to the display frame buffer.
+  \param[in]  x0        Box top-left corner X coordinate (ML image).
+  \param[in]  y0        Box top-left corner Y coordinate (ML image).
+  \param[in]  w         Box width (ML image).
+  \param[in]  h         Box height (ML image).
+*/
+static void overlay_box(uint8_t *outFrame, const uint32_t x0, const uint32_t y0, const uint32_t w, const uint32_t h)
+{
+    const int32_t lw = DISPLAY_OVERLAY_LINE_WIDTH;
+
+    const int32_t bx0 = DISPLAY_IMAGE_X + (int32_t)((x0 * DISPLAY_IMAGE_WIDTH) / ML_IMAGE_WIDTH);
+    const int32_t by0 = DISPLAY_IMAGE_Y + (int32_t)((y0 * DISPLAY_IMAGE_HEIGHT) / ML_IMAGE_HEIGHT);
+    const int32_t bx1 = DISPLAY_IMAGE_X + (int32_t)(((x0 + w) * DISPLAY_IMAGE_WIDTH) / ML_IMAGE_WIDTH);
+    const int32_t by1 = DISPLAY_IMAGE_Y + (int32_t)(((y0 + h) * DISPLAY_IMAGE_HEIGHT) / ML_IMAGE_HEIGHT);
 
-    for (uint32_t j = 0; j < h; ++j) {
-        dst_0[1] = 255;
-        dst_1[1] = 255;
+    /* Horizontal lines are filled as spans, vertical lines as narrow rectangles */
+    overlay_fill(outFrame, bx0, by0, bx1 + lw, by0 + lw, DISPLAY_OVERLAY_COLOR);
+    overlay_fill(outFrame, bx0, by1, bx1 + lw, by1 + lw, DISPLAY_OVERLAY_COLOR);
+    overlay_fill(outFrame, bx0, by0 + lw, bx0 + lw, by1, DISPLAY_OVERLAY_COLOR);
+    overlay_fill(outFrame, bx1, by0 + lw, bx1 + lw, by1, DISPLAY_OVERLAY_COLOR);
 
-        dst_0 += step;
-        dst_1 += step;
+    Display_Rect *dirty = &Overlay_Dirty[(outFrame - LCD_Frame) / DISPLAY_IMAGE_SIZE];
+    if ((dirty->x1 <= dirty->x0) || (dirty->y1 <= dirty->y0)) {
+        dirty->x0 = bx0;
+        dirty->y0 = by0;
+        dirty->x1 = bx1 + lw;
+        dirty->y1 = by1 + lw;
+    } else {
+        dirty->x0 = (bx0 < dirty->x0) ? bx0 : dirty->x0;
+        dirty->y0 = (by0 < dirty->y0) ? by0 : dirty->y0;
+        dirty->x1 = ((bx1 + lw) > dirty->x1) ? (bx1 + lw) : dirty->x1;
+        dirty->y1 = ((by1 + lw) > dirty->y1) ? (by1 + lw) : dirty->y1;
     }
 }
 
+#if (ML_INPUT_DIRECT == 0)
 /*
   Converts camera frame and copies it to RGB image buffer.
 
-  Camera frame may be square or non-square and must be in RAW8 or RGB565 format.
+  Camera frame may be square or non-square and must be in RAW8, RGB565, RGB888
+  or YUV 4:2:0 (YUV420, NV12, NV21) format.
   RGB image buffer is always square and is in RGB888 format.
 
   The function handles the following cases:
     - If the camera frame is square and matches the RGB image size:
       - crop and debayer the RAW8 camera frame
       - convert RGB565 camera frame to RGB888
-      - copy RGB888 camera frame to RGB image buffer.
+      - copy RGB888 camera frame to RGB image buffer
+      - convert YUV camera frame to RGB888.
     - If the camera frame is square and larger than the RGB image size:
       - crop and debayer the RAW8 camera frame
       - resize RGB565 camera frame to fit into RGB image buffer.
       - resize RGB888 camera frame to fit into RGB image buffer.
+      - resize and convert YUV camera frame to fit into RGB image buffer.
     - If the camera frame is not square:
       - crop and debayer the RAW8 camera frame
       - crop RGB565 camera frame to fit into RGB image buffer.
       - crop RGB888 camera frame to fit into RGB image buffer.
+      - crop and convert YUV camera frame to fit into RGB image buffer.
 */
 static void convert_frame_to_rgb(uint8_t *inFrame) {
     #if (CAMERA_FRAME_WIDTH == CAMERA_FRAME_HEIGHT)
@@ -280,34 +1059,40 @@ static void convert_frame_to_rgb(uint8_t *inFrame) {
         /* Camera frame size matches RGB image size */
         #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
             /* For RAW8, crop and debayer into RGB image buffer (RGB888) */
-            crop_and_debayer(inFrame,
-                            CAMERA_FRAME_WIDTH,
-                            CAMERA_FRAME_HEIGHT,
-                            0, 0, /* Crop from top-left corner */
-                            RGB_Image,
-                            RGB_IMAGE_WIDTH,
-                            RGB_IMAGE_HEIGHT,
-                            CAMERA_FRAME_BAYER);
+            crop_and_debayer_planned(&Debayer_Plan,
+                                     inFrame,
+                                     RGB_Image,
+                                     CAMERA_FRAME_BAYER,
+                                     0);
         #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
             /* For RGB565, convert frame to fit into RGB image buffer (RGB888) */
             convert_rgb565_to_rgb888(inFrame, RGB_Image, CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT);
         #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB888)
             /* For RGB888, just copy the frame */
             memcpy(RGB_Image, inFrame, CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT * 3);
+        #elif defined(CAMERA_FRAME_YUV)
+            /* For YUV, convert frame to fit into RGB image buffer (RGB888) */
+            crop_and_resize_yuv420(inFrame,
+                                   CAMERA_FRAME_WIDTH,
+                                   CAMERA_FRAME_HEIGHT,
+                                   0, 0,
+                                   CAMERA_FRAME_WIDTH,
+                                   CAMERA_FRAME_HEIGHT,
+                                   RGB_Image,
+                                   RGB_IMAGE_WIDTH,
+                                   RGB_IMAGE_HEIGHT,
+                                   CAMERA_FRAME_YUV_FORMAT,
+                                   IMAGE_FORMAT_RGB888);
         #endif
       #else
         /* Camera frame size is larger than RGB image size */
         #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
             /* For RAW8, crop and debayer into RGB image buffer (RGB888) */
-            crop_and_debayer(inFrame,
-                            CAMERA_FRAME_WIDTH,
-                            CAMERA_FRAME_HEIGHT,
-                            (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
-                            (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
-                            RGB_Image,
-                            RGB_IMAGE_WIDTH,
-                            RGB_IMAGE_HEIGHT,
-                            CAMERA_FRAME_BAYER);
+            crop_and_debayer_planned(&Debayer_Plan,
+                                     inFrame,
+                                     RGB_Image,
+                                     CAMERA_FRAME_BAYER,
+                                     0);
         #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
             /* For RGB565, resize frame to fit into RGB image buffer (RGB888) */
             image_resize(inFrame,
@@ -328,6 +1113,19 @@ static void convert_frame_to_rgb(uint8_t *inFrame) {
                         RGB_IMAGE_HEIGHT,
                         IMAGE_FORMAT_RGB888,
                         IMAGE_FORMAT_RGB888);
+        #elif defined(CAMERA_FRAME_YUV)
+            /* For YUV, resize and convert frame in one pass into RGB image buffer (RGB888) */
+            crop_and_resize_yuv420(inFrame,
+                                   CAMERA_FRAME_WIDTH,
+                                   CAMERA_FRAME_HEIGHT,
+                                   0, 0,
+                                   CAMERA_FRAME_WIDTH,
+                                   CAMERA_FRAME_HEIGHT,
+                                   RGB_Image,
+                                   RGB_IMAGE_WIDTH,
+                                   RGB_IMAGE_HEIGHT,
+                                   CAMERA_FRAME_YUV_FORMAT,
+                                   IMAGE_FORMAT_RGB888);
         #endif
       #endif
     #endif
@@ -336,15 +1134,11 @@ static void convert_frame_to_rgb(uint8_t *inFrame) {
       /* Camera frame is not square, crop it to fit RGB buffer */
       #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
         /* For RAW8, crop and debayer to RGB888 */
-        crop_and_debayer(inFrame,
-                        CAMERA_FRAME_WIDTH,
-                        CAMERA_FRAME_HEIGHT,
-                        (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
-                        (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
-                        RGB_Image,
-                        RGB_IMAGE_WIDTH,
-                        RGB_IMAGE_HEIGHT,
-                        CAMERA_FRAME_BAYER);
+        crop_and_debayer_planned(&Debayer_Plan,
+                                 inFrame,
+                                 RGB_Image,
+                                 CAMERA_FRAME_BAYER,
+                                 0);
       #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
         /* For RGB565, crop and convert to RGB888 */
         crop_rgb565_to_rgb888(inFrame,
@@ -365,6 +1159,21 @@ static void convert_frame_to_rgb(uint8_t *inFrame) {
                             (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
                             RGB_IMAGE_WIDTH,
                             RGB_IMAGE_HEIGHT);
+      #elif defined(CAMERA_FRAME_YUV)
+        /* For YUV, crop and convert to RGB888 */
+        crop_and_resize_yuv420(inFrame,
+                               CAMERA_FRAME_WIDTH,
+                               CAMERA_FRAME_HEIGHT,
+                               (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
+                               (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
+                               RGB_IMAGE_WIDTH,
+                               RGB_IMAGE_HEIGHT,
+                               RGB_Image,
+                               RGB_IMAGE_WIDTH,
+                               RGB_IMAGE_HEIGHT,
+                               CAMERA_FRAME_YUV_FORMAT,
+                               IMAGE_FORMAT_RGB888);
       #endif
     #endif
 }
+#endif
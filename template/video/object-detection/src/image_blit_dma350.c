@@ -0,0 +1,150 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  DMA-350 implementation of the asynchronous 2D blit.
+
+  Overrides the __WEAK synchronous image_blit_async from
+  image_processing_func.c on Corstone-310/315/320 when the DMA350 native
+  driver component (Device:Native Driver:DMA350) is selected. The copy is
+  done by DMA channel 0 and completion is signalled from its interrupt.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "RTE_Components.h"
+#include "image_processing_func.h"
+
+#if defined(RTE_DMA350)
+
+#include CMSIS_device_header
+#include "device_definition.h"
+#include "dma350_ch_drv.h"
+#include "dma350_lib.h"
+
+/* Largest line and height supported by the 2D transfer */
+#define DMA350_MAX_2D_SIZE      0xFFFFU
+
+static struct dma350_ch_dev_t *const Blit_Channel = &DMA350_DMA0_CH0_DEV_S;
+
+static volatile uint8_t       Blit_Busy     = 0U;
+static uint8_t                Blit_Ready    = 0U;
+static image_blit_callback_t  Blit_Callback = NULL;
+static void                  *Blit_Arg      = NULL;
+
+/*
+  Initialize DMA controller and blit channel on first use.
+
+  \return 0 on success, -1 on error.
+*/
+static int blit_dma_init(void) {
+  if (Blit_Ready == 0U) {
+    if (dma350_init(&DMA350_DMA0_DEV_S) != DMA350_ERR_NONE) {
+      return -1;
+    }
+    if (dma350_ch_init(Blit_Channel) != DMA350_CH_ERR_NONE) {
+      return -1;
+    }
+    NVIC_ClearPendingIRQ(DMA_Channel_0_IRQn);
+    NVIC_EnableIRQ(DMA_Channel_0_IRQn);
+    Blit_Ready = 1U;
+  }
+  return 0;
+}
+
+int image_blit_async(const image_blit_t *blit, image_blit_callback_t callback, void *arg) {
+  image_blit_t clipped;
+
+  if (Blit_Busy != 0U) {
+    return -1;
+  }
+
+  if (image_blit_clip(blit, &clipped) == 0) {
+    /* Nothing visible, complete immediately */
+    if (callback != NULL) {
+      callback(0, arg);
+    }
+    return 0;
+  }
+
+  /* The transfer is done with byte sized elements, so pixels of any size can be moved */
+  const uint32_t row_bytes = (uint32_t)clipped.src_width * (uint32_t)clipped.bpp;
+
+  if ((row_bytes > DMA350_MAX_2D_SIZE) ||
+      ((uint32_t)clipped.src_stride > DMA350_MAX_2D_SIZE) ||
+      ((uint32_t)clipped.dst_stride > DMA350_MAX_2D_SIZE) ||
+      ((uint32_t)clipped.src_height > DMA350_MAX_2D_SIZE) ||
+      (blit_dma_init() != 0)) {
+    /* Not suitable for DMA, copy synchronously */
+    image_blit(&clipped);
+    if (callback != NULL) {
+      callback(0, arg);
+    }
+    return 0;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* DMA accesses memory directly, write back the source and drop stale destination lines */
+  const int32_t src_size = (clipped.src_height - 1) * clipped.src_stride + (int32_t)row_bytes;
+  const int32_t dst_size = (clipped.src_height - 1) * clipped.dst_stride + (int32_t)row_bytes;
+  SCB_CleanDCache_by_Addr((volatile void *)clipped.src, src_size);
+  SCB_CleanInvalidateDCache_by_Addr((volatile void *)clipped.dst, dst_size);
+#endif
+
+  Blit_Callback = callback;
+  Blit_Arg      = arg;
+  Blit_Busy     = 1U;
+
+  if (dma350_draw_from_canvas(Blit_Channel,
+                              clipped.src,
+                              clipped.dst,
+                              row_bytes,
+                              (uint16_t)clipped.src_height,
+                              (uint16_t)clipped.src_stride,
+                              row_bytes,
+                              (uint16_t)clipped.src_height,
+                              (uint16_t)clipped.dst_stride,
+                              DMA350_LIB_PIXELSIZE_8,
+                              DMA350_LIB_TRANSFORM_NONE,
+                              DMA350_LIB_EXEC_IRQ) != DMA350_LIB_ERR_NONE) {
+    Blit_Busy = 0U;
+    return -1;
+  }
+  return 0;
+}
+
+/*
+  DMA-350 channel 0 interrupt handler (overrides the default handler).
+*/
+void DMA_Channel_0_Handler(void) {
+  int status = 0;
+
+  if (dma350_ch_is_stat_set(Blit_Channel, DMA350_CH_STAT_ERR)) {
+    status = -1;
+  }
+  dma350_ch_clear_stat(Blit_Channel, DMA350_CH_STAT_DONE);
+  dma350_ch_clear_stat(Blit_Channel, DMA350_CH_STAT_ERR);
+
+  Blit_Busy = 0U;
+
+  if (Blit_Callback != NULL) {
+    Blit_Callback(status, Blit_Arg);
+  }
+}
+
+#endif /* defined(RTE_DMA350) */
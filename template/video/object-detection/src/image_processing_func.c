@@ -17,6 +17,7 @@
  *---------------------------------------------------------------------------*/
 
 #include <stdint.h>
+#include <string.h>
 #include "cmsis_compiler.h"
 #include "image_processing_func.h"
 
@@ -37,148 +38,323 @@ static inline int clamp(int val, int min, int max) {
   return (val < min) ? min : (val > max) ? max : val;
 }
 
+void bayer_offsets(bayer_pattern_t pattern, int offsets[2][2]) {
+  switch (pattern) {
+    case BAYER_PATTERN_BGGR: offsets[0][0] = 0; offsets[0][1] = 1; offsets[1][0] = 1; offsets[1][1] = 2; break;
+    case BAYER_PATTERN_GBRG: offsets[0][0] = 1; offsets[0][1] = 0; offsets[1][0] = 2; offsets[1][1] = 1; break;
+    case BAYER_PATTERN_GRBG: offsets[0][0] = 1; offsets[0][1] = 2; offsets[1][0] = 0; offsets[1][1] = 1; break;
+    case BAYER_PATTERN_RGGB: offsets[0][0] = 2; offsets[0][1] = 1; offsets[1][0] = 1; offsets[1][1] = 0; break;
+    default:                 offsets[0][0] = 0; offsets[0][1] = 0; offsets[1][0] = 0; offsets[1][1] = 0; break;
+  }
+}
+
+/*
+  Debayer a pixel on a red or blue colour site.
+
+  \param[in]  above    Pointer to the raw row above the processed row.
+  \param[in]  cur      Pointer to the raw processed row.
+  \param[in]  below    Pointer to the raw row below the processed row.
+  \param[in]  xl       Index of the left neighbour column.
+  \param[in]  x        Index of the processed column.
+  \param[in]  xr       Index of the right neighbour column.
+  \param[out] rgb      Pointer to the output RGB row.
+  \param[in]  i_own    Output channel index of the pixel's own colour.
+  \param[in]  i_other  Output channel index of the opposite colour.
+*/
+static inline void debayer_colour_px(const uint8_t *above,
+                                     const uint8_t *cur,
+                                     const uint8_t *below,
+                                     int xl, int x, int xr,
+                                     uint8_t *rgb,
+                                     int i_own,
+                                     int i_other) {
+  uint8_t *px = &rgb[x * 3];
+
+  px[i_own]   = cur[x];
+  px[1]       = (uint8_t)((cur[xl] + cur[xr] + above[x] + below[x]) >> 2);
+  px[i_other] = (uint8_t)((above[xl] + above[xr] + below[xl] + below[xr]) >> 2);
+}
+
+/*
+  Debayer a pixel on a green colour site.
+
+  Parameters are the same as for debayer_colour_px, where i_own is the output
+  channel index of the colour of the row (horizontal neighbours) and i_other
+  of the colour of the adjacent rows (vertical neighbours).
+*/
+static inline void debayer_green_px(const uint8_t *above,
+                                    const uint8_t *cur,
+                                    const uint8_t *below,
+                                    int xl, int x, int xr,
+                                    uint8_t *rgb,
+                                    int i_own,
+                                    int i_other) {
+  uint8_t *px = &rgb[x * 3];
+
+  px[1]       = cur[x];
+  px[i_own]   = (uint8_t)((cur[xl] + cur[xr]) >> 1);
+  px[i_other] = (uint8_t)((above[x] + below[x]) >> 1);
+}
+
+/*
+  Debayer one image row.
+
+  Every row of a 2x2 Bayer quad holds one green site and one red or blue site,
+  so the roles of the even and odd columns are resolved once per row and
+  interior pixels are processed in pairs with a fixed formula each. The first
+  and the last pixel use the mirrored neighbour column, which has the same
+  colour site as the missing one.
+
+  \param[in]  above    Pointer to the raw row above the processed row.
+  \param[in]  cur      Pointer to the raw processed row.
+  \param[in]  below    Pointer to the raw row below the processed row.
+  \param[out] rgb      Pointer to the output RGB row (size: width × 3).
+  \param[in]  width    Width of the image in pixels (at least 2).
+  \param[in]  y        Index of the processed row in the image.
+  \param[in]  offsets  Colour site offsets (see bayer_offsets).
+  \param[in]  swap_rb  If non-zero, swap the red and blue channels in the output.
+*/
+static void debayer_row(const uint8_t *above,
+                        const uint8_t *cur,
+                        const uint8_t *below,
+                        uint8_t *rgb,
+                        int width,
+                        int y,
+                        const int offsets[2][2],
+                        int swap_rb) {
+  const int *site = offsets[y & 1];
+
+  /* Column parity of green sites and colour of the other site on this row */
+  const int g_col   = (site[0] == 1) ? 0 : 1;
+  const int colour  = site[g_col ^ 1];
+  const int i_own   = (swap_rb != 0) ? colour : (2 - colour);
+  const int i_other = 2 - i_own;
+
+  /* Left border */
+  if (g_col == 0) {
+    debayer_green_px(above, cur, below, 1, 0, 1, rgb, i_own, i_other);
+  } else {
+    debayer_colour_px(above, cur, below, 1, 0, 1, rgb, i_own, i_other);
+  }
+
+  /* Interior pixel pairs (x, x+1), x odd */
+  int x = 1;
+  for (; x + 1 < width - 1; x += 2) {
+    const int xg = x + (g_col ^ 1);
+    const int xc = x + g_col;
+
+    debayer_green_px (above, cur, below, xg - 1, xg, xg + 1, rgb, i_own, i_other);
+    debayer_colour_px(above, cur, below, xc - 1, xc, xc + 1, rgb, i_own, i_other);
+  }
+
+  /* Remaining interior pixel (odd width) */
+  if (x < width - 1) {
+    if ((x & 1) == g_col) {
+      debayer_green_px(above, cur, below, x - 1, x, x + 1, rgb, i_own, i_other);
+    } else {
+      debayer_colour_px(above, cur, below, x - 1, x, x + 1, rgb, i_own, i_other);
+    }
+  }
+
+  /* Right border */
+  const int xe = width - 1;
+  if ((xe & 1) == g_col) {
+    debayer_green_px(above, cur, below, xe - 1, xe, xe - 1, rgb, i_own, i_other);
+  } else {
+    debayer_colour_px(above, cur, below, xe - 1, xe, xe - 1, rgb, i_own, i_other);
+  }
+}
+
 __WEAK void image_debayer(const uint8_t *raw,
                           uint8_t *rgb,
                           int width,
                           int height,
                           bayer_pattern_t pattern,
                           int swap_rb) {
-  for (int y = 1; y < height - 1; ++y) {
-    for (int x = 1; x < width - 1; ++x) {
-      int idx = y * width + x;
-      int r = 0, g = 0, b = 0;
-
-      int is_even_row = (y & 1) == 0;
-      int is_even_col = (x & 1) == 0;
-
-      switch (pattern) {
-        case BAYER_PATTERN_RGGB:
-          if (is_even_row) {
-            if (is_even_col) {
-              // Red
-              r = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              b = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            } else {
-              // Green (on red row)
-              g = raw[idx];
-              r = (raw[idx - 1] + raw[idx + 1]) >> 1;
-              b = (raw[idx - width] + raw[idx + width]) >> 1;
-            }
-          } else {
-            if (is_even_col) {
-              // Green (on blue row)
-              g = raw[idx];
-              r = (raw[idx - width] + raw[idx + width]) >> 1;
-              b = (raw[idx - 1] + raw[idx + 1]) >> 1;
-            } else {
-              // Blue
-              b = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              r = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            }
-          }
-          break;
-
-        case BAYER_PATTERN_BGGR:
-          if (is_even_row) {
-            if (is_even_col) {
-              // Blue
-              b = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              r = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            } else {
-              // Green (on blue row)
-              g = raw[idx];
-              b = (raw[idx - 1] + raw[idx + 1]) >> 1;
-              r = (raw[idx - width] + raw[idx + width]) >> 1;
-            }
-          } else {
-            if (is_even_col) {
-              // Green (on red row)
-              g = raw[idx];
-              b = (raw[idx - width] + raw[idx + width]) >> 1;
-              r = (raw[idx - 1] + raw[idx + 1]) >> 1;
-            } else {
-              // Red
-              r = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              b = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            }
-          }
-          break;
-
-        case BAYER_PATTERN_GRBG:
-          if (is_even_row) {
-            if (is_even_col) {
-              // Green (on red row)
-              g = raw[idx];
-              r = (raw[idx - 1] + raw[idx + 1]) >> 1;
-              b = (raw[idx - width] + raw[idx + width]) >> 1;
-            } else {
-              // Red
-              r = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              b = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            }
-          } else {
-            if (is_even_col) {
-              // Blue
-              b = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              r = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            } else {
-              // Green (on blue row)
-              g = raw[idx];
-              b = (raw[idx - 1] + raw[idx + 1]) >> 1;
-              r = (raw[idx - width] + raw[idx + width]) >> 1;
-            }
-          }
-          break;
-
-        case BAYER_PATTERN_GBRG:
-          if (is_even_row) {
-            if (is_even_col) {
-              // Green (on blue row)
-              g = raw[idx];
-              b = (raw[idx - 1] + raw[idx + 1]) >> 1;
-              r = (raw[idx - width] + raw[idx + width]) >> 1;
-            } else {
-              // Blue
-              b = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              r = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            }
-          } else {
-            if (is_even_col) {
-              // Red
-              r = raw[idx];
-              g = (raw[idx - 1] + raw[idx + 1] + raw[idx - width] + raw[idx + width]) >> 2;
-              b = (raw[idx - width - 1] + raw[idx - width + 1] + raw[idx + width - 1] + raw[idx + width + 1]) >> 2;
-            } else {
-              // Green (on red row)
-              g = raw[idx];
-              r = (raw[idx - 1] + raw[idx + 1]) >> 1;
-              b = (raw[idx - width] + raw[idx + width]) >> 1;
-            }
-          }
-          break;
-      }
+  int offsets[2][2];
+  bayer_offsets(pattern, offsets);
 
-      int out_idx = (y * width + x) * 3;
-      if (swap_rb == 0) {
-        rgb[out_idx + 0] = (uint8_t)r;
-        rgb[out_idx + 1] = (uint8_t)g;
-        rgb[out_idx + 2] = (uint8_t)b;
-      } else {
-        rgb[out_idx + 0] = (uint8_t)b;
-        rgb[out_idx + 1] = (uint8_t)g;
-        rgb[out_idx + 2] = (uint8_t)r;
-      }
+  for (int y = 0; y < height; ++y) {
+    /* Mirror the missing neighbour row at the top and bottom border */
+    const int ya = (y == 0)          ? 1          : (y - 1);
+    const int yb = (y == height - 1) ? (height - 2) : (y + 1);
+
+    debayer_row(&raw[ya * width],
+                &raw[y  * width],
+                &raw[yb * width],
+                &rgb[y * width * 3],
+                width,
+                y,
+                offsets,
+                swap_rb);
+  }
+}
+
+/*
+  Get source row sampled for an output row of crop_and_debayer.
+
+  \param[in]  dy          Index of the output row.
+  \param[in]  src_height  Height of the input RAW8 image in pixels.
+  \param[in]  src_crop_y  Y offset of the top-left corner of the crop region.
+  \param[in]  dst_height  Height of the output image in pixels.
+  \return                 Index of the source row (1 to src_height-2).
+*/
+static int crop_src_row(int dy, int src_height, int src_crop_y, int dst_height) {
+  int sy_fp = (dy * (src_height - 2 - src_crop_y * 2) << 8) / (dst_height - 1); // fixed-point
+  int sy = sy_fp >> 8;
+
+  sy += src_crop_y;
+  if (sy < 1) {
+    sy = 1;
+  }
+  if (sy >= src_height - 2) {
+    sy = src_height - 2;
+  }
+  return sy;
+}
+
+/*
+  Get source column sampled for an output column of crop_and_debayer.
+
+  \param[in]  dx          Index of the output column.
+  \param[in]  src_width   Width of the input RAW8 image in pixels.
+  \param[in]  src_crop_x  X offset of the top-left corner of the crop region.
+  \param[in]  dst_width   Width of the output image in pixels.
+  \return                 Index of the source column (1 to src_width-2).
+*/
+static int crop_src_col(int dx, int src_width, int src_crop_x, int dst_width) {
+  int sx_fp = (dx * (src_width - 2 - src_crop_x * 2) << 8) / (dst_width - 1); // fixed-point
+  int sx = sx_fp >> 8;
+
+  sx += src_crop_x;
+  if (sx < 1) {
+    sx = 1;
+  }
+  if (sx >= src_width - 2) {
+    sx = src_width - 2;
+  }
+  return sx;
+}
+
+/*
+  Crop, scale and debayer one output row.
+
+  \param[in]  above       Pointer to the source row above the sampled row.
+  \param[in]  cur         Pointer to the sampled source row.
+  \param[in]  below       Pointer to the source row below the sampled row.
+  \param[in]  sy          Index of the sampled source row.
+  \param[in]  src_width   Width of the input RAW8 image in pixels.
+  \param[in]  src_crop_x  X offset of the top-left corner of the crop region.
+  \param[out] dst_row     Pointer to the output RGB888 row.
+  \param[in]  dst_width   Width of the output image in pixels.
+  \param[in]  offsets     Colour site offsets (see bayer_offsets).
+  \param[in]  mask        Value XOR-ed into every output byte.
+  \param[in]  cols        Precomputed source columns or NULL to compute them.
+*/
+static void crop_and_debayer_row(const uint8_t *above,
+                                 const uint8_t *cur,
+                                 const uint8_t *below,
+                                 int sy,
+                                 int src_width,
+                                 int src_crop_x,
+                                 uint8_t *dst_row,
+                                 int dst_width,
+                                 const int offsets[2][2],
+                                 uint8_t mask,
+                                 const uint16_t *cols) {
+  int row_parity = sy & 1;
+
+  for (int dx = 0; dx < dst_width; ++dx) {
+    int sx = (cols != NULL) ? cols[dx] : crop_src_col(dx, src_width, src_crop_x, dst_width);
+
+    int col_parity = sx & 1;
+    int offset = offsets[row_parity][col_parity];
+
+    int center = cur[sx];
+
+    int r = 0;
+    int g = 0;
+    int b = 0;
+
+    switch (offset) {
+      case 0: // Blue
+        b = center;
+        g = (cur[sx - 1] + cur[sx + 1] + above[sx] + below[sx]) / 4;
+        r = (above[sx - 1] + above[sx + 1] + below[sx - 1] + below[sx + 1]) / 4;
+        break;
+
+      case 1: // Green
+        g = center;
+        if ((row_parity == 0 && col_parity == 1) || (row_parity == 1 && col_parity == 0)) {
+          r = (cur[sx - 1] + cur[sx + 1]) / 2;
+          b = (above[sx] + below[sx]) / 2;
+        } else {
+          b = (cur[sx - 1] + cur[sx + 1]) / 2;
+          r = (above[sx] + below[sx]) / 2;
+        }
+        break;
+
+      case 2: // Red
+        r = center;
+        g = (cur[sx - 1] + cur[sx + 1] + above[sx] + below[sx]) / 4;
+        b = (above[sx - 1] + above[sx + 1] + below[sx - 1] + below[sx + 1]) / 4;
+        break;
     }
+
+    dst_row[dx * 3 + 0] = (uint8_t)clamp(r, 0, 255) ^ mask;
+    dst_row[dx * 3 + 1] = (uint8_t)clamp(g, 0, 255) ^ mask;
+    dst_row[dx * 3 + 2] = (uint8_t)clamp(b, 0, 255) ^ mask;
   }
 }
 
+/*
+  Crop, scale and debayer a RAW8 Bayer image into an RGB888 buffer.
+
+  Common implementation of crop_and_debayer and the RGB888 output of
+  crop_and_debayer_to_input.
+  Every output byte is XOR-ed with the given mask, which allows the result to
+  be written directly as unsigned (mask 0x00) or signed (mask 0x80) data.
+
+  \param[in]  src         Pointer to the input RAW8 image buffer.
+  \param[in]  src_width   Width of the input RAW8 image in pixels.
+  \param[in]  src_height  Height of the input RAW8 image in pixels.
+  \param[in]  src_crop_x  X offset of the top-left corner of the crop region.
+  \param[in]  src_crop_y  Y offset of the top-left corner of the crop region.
+  \param[out] dst_rgb     Pointer to the output RGB888 buffer.
+  \param[in]  dst_width   Width of the output image in pixels.
+  \param[in]  dst_height  Height of the output image in pixels.
+  \param[in]  pattern     Bayer pattern used in the RAW8 image.
+  \param[in]  mask        Value XOR-ed into every output byte.
+*/
+static void crop_and_debayer_xor(const uint8_t *src,
+                                 int src_width,
+                                 int src_height,
+                                 int src_crop_x,
+                                 int src_crop_y,
+                                 uint8_t *dst_rgb,
+                                 int dst_width,
+                                 int dst_height,
+                                 bayer_pattern_t pattern,
+                                 uint8_t mask) {
+  int offsets[2][2];
+  bayer_offsets(pattern, offsets);
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    int sy = crop_src_row(dy, src_height, src_crop_y, dst_height);
+
+    crop_and_debayer_row(&src[(sy - 1) * src_width],
+                         &src[sy * src_width],
+                         &src[(sy + 1) * src_width],
+                         sy,
+                         src_width,
+                         src_crop_x,
+                         &dst_rgb[dy * dst_width * 3],
+                         dst_width,
+                         (const int (*)[2])offsets,
+                         mask,
+                         NULL);
+  }
+}
 
 __WEAK void crop_and_debayer(const uint8_t *src,
                              int src_width,
@@ -189,84 +365,78 @@ __WEAK void crop_and_debayer(const uint8_t *src,
                              int dst_width,
                              int dst_height,
                              bayer_pattern_t pattern) {
-  int offsets[2][2];
-  switch (pattern) {
-    case BAYER_PATTERN_BGGR: offsets[0][0] = 0; offsets[0][1] = 1; offsets[1][0] = 1; offsets[1][1] = 2; break;
-    case BAYER_PATTERN_GBRG: offsets[0][0] = 1; offsets[0][1] = 0; offsets[1][0] = 2; offsets[1][1] = 1; break;
-    case BAYER_PATTERN_GRBG: offsets[0][0] = 1; offsets[0][1] = 2; offsets[1][0] = 0; offsets[1][1] = 1; break;
-    case BAYER_PATTERN_RGGB: offsets[0][0] = 2; offsets[0][1] = 1; offsets[1][0] = 1; offsets[1][1] = 0; break;
+  crop_and_debayer_xor(src, src_width, src_height, src_crop_x, src_crop_y,
+                       dst_rgb, dst_width, dst_height, pattern, 0x00U);
+}
+
+/*
+  Get log2 of a supported decimation factor.
+
+  \param[in] factor  Decimation factor.
+  \return            log2(factor) for factor 2, 4 or 8, otherwise 0.
+*/
+static inline int decimation_shift(int factor) {
+  return (factor == 2) ? 1 :
+         (factor == 4) ? 2 :
+         (factor == 8) ? 3 : 0;
+}
+
+__WEAK void crop_and_debayer_decimate(const uint8_t *src,
+                                      int src_width,
+                                      int src_height,
+                                      int src_crop_x,
+                                      int src_crop_y,
+                                      uint8_t *dst_rgb,
+                                      int dst_width,
+                                      int dst_height,
+                                      int factor,
+                                      bayer_pattern_t pattern) {
+  int shift = decimation_shift(factor);
+  if (shift == 0) {
+    return; // unsupported factor
+  }
+  if ((src_crop_x < 0) || (src_crop_y < 0) ||
+      (src_crop_x + dst_width * factor > src_width) ||
+      (src_crop_y + dst_height * factor > src_height)) {
+    return; // crop region outside of the source image
   }
 
-  for (int dy = 0; dy < dst_height; ++dy) {
-    int sy_fp = (dy * (src_height - 2 - src_crop_y * 2) << 8) / (dst_height - 1); // fixed-point
-    int sy = sy_fp >> 8;
-    int dy_frac = sy_fp & 0xFF;
+  /* Each block holds factor^2/4 red and blue samples and factor^2/2 green samples */
+  const int rb_shift = 2 * shift - 2;
+  const int g_shift  = 2 * shift - 1;
+  const int rb_round = (1 << rb_shift) >> 1;
+  const int g_round  = (1 << g_shift) >> 1;
 
-    sy += src_crop_y;
-    if (sy < 1) {
-      sy = 1;
-    }
-    if (sy >= src_height - 2) {
-      sy = src_height - 2;
+  /* Blocks start at even distance from crop origin, so all share the same 2x2 site layout */
+  int offsets[2][2];
+  int site[2][2];
+  bayer_offsets(pattern, offsets);
+  for (int qy = 0; qy < 2; ++qy) {
+    for (int qx = 0; qx < 2; ++qx) {
+      site[qy][qx] = offsets[(src_crop_y + qy) & 1][(src_crop_x + qx) & 1];
     }
+  }
 
-    for (int dx = 0; dx < dst_width; ++dx) {
-      int sx_fp = (dx * (src_width - 2 - src_crop_x * 2) << 8) / (dst_width - 1); // fixed-point
-      int sx = sx_fp >> 8;
-      int dx_frac = sx_fp & 0xFF;
+  for (int dy = 0; dy < dst_height; ++dy) {
+    const uint8_t *blk_row = &src[(src_crop_y + dy * factor) * src_width + src_crop_x];
+    uint8_t *dst_row = &dst_rgb[dy * dst_width * 3];
 
-      sx += src_crop_x;
-      if (sx < 1) {
-        sx = 1;
-      }
-      if (sx >= src_width - 2) {
-        sx = src_width - 2;
-      }
+    for (int dx = 0; dx < dst_width; ++dx) {
+      const uint8_t *blk = &blk_row[dx * factor];
+      int sum[3] = { 0, 0, 0 };   // indexed by colour site: 0 = blue, 1 = green, 2 = red
 
-      int row_parity = sy & 1;
-      int col_parity = sx & 1;
-      int offset = offsets[row_parity][col_parity];
-
-      const uint8_t *p = src;
-      int center = p[sy * src_width + sx];
-
-      int r = 0;
-      int g = 0;
-      int b = 0;
-
-      switch (offset) {
-        case 0: // Blue
-          b = center;
-          g = (p[sy * src_width + sx - 1] + p[sy * src_width + sx + 1] +
-               p[(sy - 1) * src_width + sx] + p[(sy + 1) * src_width + sx]) / 4;
-          r = (p[(sy - 1) * src_width + sx - 1] + p[(sy - 1) * src_width + sx + 1] +
-               p[(sy + 1) * src_width + sx - 1] + p[(sy + 1) * src_width + sx + 1]) / 4;
-          break;
-
-        case 1: // Green
-          g = center;
-          if ((row_parity == 0 && col_parity == 1) || (row_parity == 1 && col_parity == 0)) {
-            r = (p[sy * src_width + sx - 1] + p[sy * src_width + sx + 1]) / 2;
-            b = (p[(sy - 1) * src_width + sx] + p[(sy + 1) * src_width + sx]) / 2;
-          } else {
-            b = (p[sy * src_width + sx - 1] + p[sy * src_width + sx + 1]) / 2;
-            r = (p[(sy - 1) * src_width + sx] + p[(sy + 1) * src_width + sx]) / 2;
-          }
-          break;
-
-        case 2: // Red
-          r = center;
-          g = (p[sy * src_width + sx - 1] + p[sy * src_width + sx + 1] +
-               p[(sy - 1) * src_width + sx] + p[(sy + 1) * src_width + sx]) / 4;
-          b = (p[(sy - 1) * src_width + sx - 1] + p[(sy - 1) * src_width + sx + 1] +
-               p[(sy + 1) * src_width + sx - 1] + p[(sy + 1) * src_width + sx + 1]) / 4;
-          break;
+      for (int j = 0; j < factor; ++j) {
+        const uint8_t *p = &blk[j * src_width];
+        const int *s = site[j & 1];
+        for (int i = 0; i < factor; i += 2) {
+          sum[s[0]] += p[i];
+          sum[s[1]] += p[i + 1];
+        }
       }
 
-      int dst_idx = (dy * dst_width + dx) * 3;
-      dst_rgb[dst_idx + 0] = (uint8_t)clamp(r, 0, 255);
-      dst_rgb[dst_idx + 1] = (uint8_t)clamp(g, 0, 255);
-      dst_rgb[dst_idx + 2] = (uint8_t)clamp(b, 0, 255);
+      dst_row[dx * 3 + 0] = (uint8_t)((sum[2] + rb_round) >> rb_shift);
+      dst_row[dx * 3 + 1] = (uint8_t)((sum[1] + g_round)  >> g_shift);
+      dst_row[dx * 3 + 2] = (uint8_t)((sum[0] + rb_round) >> rb_shift);
     }
   }
 }
@@ -275,43 +445,177 @@ __WEAK void crop_and_debayer(const uint8_t *src,
 #define FP_ONE   (1 << FP_SHIFT)
 #define FP_MASK  (FP_ONE - 1)
 
-static void unpack_pixel(const uint8_t *buf, image_format_t format, int *r, int *g, int *b) {
-  switch (format) {
-    case IMAGE_FORMAT_GRAYSCALE:
-      *r = *g = *b = buf[0];
-      break;
-    case IMAGE_FORMAT_RGB565: {
-      uint16_t px = buf[0] | (buf[1] << 8);
-      *r = ((px >> 11) & 0x1F) << 3;
-      *g = ((px >> 5)  & 0x3F) << 2;
-      *b = (px & 0x1F) << 3;
-      break;
-    }
-    case IMAGE_FORMAT_RGB888:
-      *r = buf[0];
-      *g = buf[1];
-      *b = buf[2];
-      break;
-  }
+/*
+  Pixel access macros used to generate format specialized resize kernels.
+
+  UNPACK_<format>(p, r, g, b) reads a pixel into 8-bit R, G and B components.
+  PACK_<format>(p, r, g, b)   writes 8-bit R, G and B components as a pixel.
+  BPP_<format>                is the number of bytes per pixel.
+
+  Grayscale is packed using luminance with integer weights:
+  Y = (77R + 150G + 29B) >> 8, which approximates Y = 0.299R + 0.587G + 0.114B.
+*/
+#define BPP_GRAYSCALE   1
+#define BPP_RGB565      2
+#define BPP_RGB888      3
+
+#define UNPACK_GRAYSCALE(p, r, g, b)                                \
+  do {                                                              \
+    (r) = (g) = (b) = (p)[0];                                       \
+  } while (0)
+
+#define UNPACK_RGB565(p, r, g, b)                                   \
+  do {                                                              \
+    uint16_t px_ = (uint16_t)((p)[0] | ((p)[1] << 8));              \
+    (r) = ((px_ >> 11) & 0x1F) << 3;                                \
+    (g) = ((px_ >> 5)  & 0x3F) << 2;                                \
+    (b) = (px_ & 0x1F) << 3;                                        \
+  } while (0)
+
+#define UNPACK_RGB888(p, r, g, b)                                   \
+  do {                                                              \
+    (r) = (p)[0];                                                   \
+    (g) = (p)[1];                                                   \
+    (b) = (p)[2];                                                   \
+  } while (0)
+
+#define PACK_GRAYSCALE(p, r, g, b)                                  \
+  do {                                                              \
+    (p)[0] = (uint8_t)(((r) * 77 + (g) * 150 + (b) * 29) >> 8);     \
+  } while (0)
+
+#define PACK_RGB565(p, r, g, b)                                     \
+  do {                                                              \
+    uint16_t px_ = (uint16_t)((((r) >> 3) << 11) |                  \
+                              (((g) >> 2) << 5)  |                  \
+                               ((b) >> 3));                         \
+    (p)[0] = (uint8_t)(px_ & 0xFF);                                 \
+    (p)[1] = (uint8_t)((px_ >> 8) & 0xFF);                          \
+  } while (0)
+
+#define PACK_RGB888(p, r, g, b)                                     \
+  do {                                                              \
+    (p)[0] = (uint8_t)(r);                                          \
+    (p)[1] = (uint8_t)(g);                                          \
+    (p)[2] = (uint8_t)(b);                                          \
+  } while (0)
+
+/* Bilinear interpolation of one channel from four neighbouring samples */
+#define LERP2D(v00, v01, v10, v11, wx, wy)                                      \
+  ((((FP_ONE - (wy)) * ((((FP_ONE - (wx)) * (v00)) + ((wx) * (v01))) >> FP_SHIFT)) + \
+    ((wy)          * ((((FP_ONE - (wx)) * (v10)) + ((wx) * (v11))) >> FP_SHIFT))) >> FP_SHIFT)
+
+/* Interpolate and write one destination pixel from source columns x0 and x1 */
+#define RESIZE_PIXEL(SRC, DST, row0, row1, x0, x1, wx, wy, out)                 \
+  do {                                                                          \
+    int r00_, g00_, b00_, r01_, g01_, b01_;                                     \
+    int r10_, g10_, b10_, r11_, g11_, b11_;                                     \
+    UNPACK_##SRC(&(row0)[(x0) * BPP_##SRC], r00_, g00_, b00_);                  \
+    UNPACK_##SRC(&(row0)[(x1) * BPP_##SRC], r01_, g01_, b01_);                  \
+    UNPACK_##SRC(&(row1)[(x0) * BPP_##SRC], r10_, g10_, b10_);                  \
+    UNPACK_##SRC(&(row1)[(x1) * BPP_##SRC], r11_, g11_, b11_);                  \
+    PACK_##DST((out),                                                           \
+               LERP2D(r00_, r01_, r10_, r11_, (wx), (wy)),                      \
+               LERP2D(g00_, g01_, g10_, g11_, (wx), (wy)),                      \
+               LERP2D(b00_, b01_, b10_, b11_, (wx), (wy)));                     \
+  } while (0)
+
+/*
+  Resize row kernel.
+
+  Resizes one output row using bilinear interpolation. Source columns and
+  weights are taken from the plan when provided, otherwise they are computed
+  from the horizontal scaling ratio.
+
+  \param[in]  row0        Pointer to the upper source row.
+  \param[in]  row1        Pointer to the lower source row.
+  \param[in]  wy          Vertical interpolation weight (fixed-point).
+  \param[in]  src_width   Width of the source image in pixels.
+  \param[out] dst_row     Pointer to the destination row.
+  \param[in]  dst_width   Width of the destination image in pixels.
+  \param[in]  x_ratio     Horizontal scaling ratio (fixed-point).
+  \param[in]  plan        Precomputed resize plan or NULL to compute columns and weights.
+*/
+typedef void (*resize_row_func_t)(const uint8_t *row0,
+                                  const uint8_t *row1,
+                                  int wy,
+                                  int src_width,
+                                  uint8_t *dst_row,
+                                  int dst_width,
+                                  int x_ratio,
+                                  const image_resize_plan_t *plan);
+
+/* Define resize row kernel for a (source format, destination format) pair */
+#define DEFINE_RESIZE_ROW(SRC, DST)                                             \
+static void resize_row_##SRC##_##DST(const uint8_t *row0,                       \
+                                     const uint8_t *row1,                       \
+                                     int wy,                                    \
+                                     int src_width,                             \
+                                     uint8_t *dst_row,                          \
+                                     int dst_width,                             \
+                                     int x_ratio,                               \
+                                     const image_resize_plan_t *plan) {         \
+  if (plan != NULL) {                                                           \
+    const uint16_t *col_idx0   = plan->col_idx0;                                \
+    const uint16_t *col_idx1   = plan->col_idx1;                                \
+    const uint16_t *col_weight = plan->col_weight;                              \
+    for (int x = 0; x < dst_width; ++x) {                                       \
+      RESIZE_PIXEL(SRC, DST, row0, row1, col_idx0[x], col_idx1[x],              \
+                   col_weight[x], wy, &dst_row[x * BPP_##DST]);                 \
+    }                                                                           \
+  } else {                                                                      \
+    for (int x = 0; x < dst_width; ++x) {                                       \
+      int src_x_fp = x * x_ratio;                                               \
+      int x0 = src_x_fp >> FP_SHIFT;                                            \
+      int x1 = (x0 < src_width - 1) ? x0 + 1 : x0;                              \
+      int wx = src_x_fp & FP_MASK;                                              \
+      RESIZE_PIXEL(SRC, DST, row0, row1, x0, x1, wx, wy,                        \
+                   &dst_row[x * BPP_##DST]);                                    \
+    }                                                                           \
+  }                                                                             \
 }
 
-static void pack_pixel(uint8_t *buf, image_format_t format, int r, int g, int b) {
-  switch (format) {
-    case IMAGE_FORMAT_GRAYSCALE:
-      buf[0] = (uint8_t)((r * 299 + g * 587 + b * 114) / 1000); // luminance
-      break;
-    case IMAGE_FORMAT_RGB565: {
-      uint16_t px = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-      buf[0] = px & 0xFF;
-      buf[1] = (px >> 8) & 0xFF;
-      break;
-    }
-    case IMAGE_FORMAT_RGB888:
-      buf[0] = (uint8_t)r;
-      buf[1] = (uint8_t)g;
-      buf[2] = (uint8_t)b;
-      break;
+DEFINE_RESIZE_ROW(GRAYSCALE, GRAYSCALE)
+DEFINE_RESIZE_ROW(GRAYSCALE, RGB565)
+DEFINE_RESIZE_ROW(GRAYSCALE, RGB888)
+DEFINE_RESIZE_ROW(RGB565,    GRAYSCALE)
+DEFINE_RESIZE_ROW(RGB565,    RGB565)
+DEFINE_RESIZE_ROW(RGB565,    RGB888)
+DEFINE_RESIZE_ROW(RGB888,    GRAYSCALE)
+DEFINE_RESIZE_ROW(RGB888,    RGB565)
+DEFINE_RESIZE_ROW(RGB888,    RGB888)
+
+/* Resize row kernels indexed by [src_format][dst_format] */
+static const resize_row_func_t resize_row_kernels[3][3] = {
+  { resize_row_GRAYSCALE_GRAYSCALE, resize_row_GRAYSCALE_RGB565, resize_row_GRAYSCALE_RGB888 },
+  { resize_row_RGB565_GRAYSCALE,    resize_row_RGB565_RGB565,    resize_row_RGB565_RGB888    },
+  { resize_row_RGB888_GRAYSCALE,    resize_row_RGB888_RGB565,    resize_row_RGB888_RGB888    }
+};
+
+/*
+  Get number of bytes per pixel for an image format.
+
+  \param[in] format  Image format.
+  \return            Number of bytes per pixel.
+*/
+static inline int format_bpp(image_format_t format) {
+  return (format == IMAGE_FORMAT_GRAYSCALE) ? 1 :
+         (format == IMAGE_FORMAT_RGB565)    ? 2 : 3;
+}
+
+/*
+  Select resize row kernel for a pair of image formats.
+
+  \param[in] src_format  Format of the source image.
+  \param[in] dst_format  Format of the destination image.
+  \return                Resize row kernel or NULL if a format is not supported.
+*/
+static resize_row_func_t resize_row_kernel(image_format_t src_format, image_format_t dst_format) {
+  if ((src_format < IMAGE_FORMAT_GRAYSCALE) || (src_format > IMAGE_FORMAT_RGB888) ||
+      (dst_format < IMAGE_FORMAT_GRAYSCALE) || (dst_format > IMAGE_FORMAT_RGB888)) {
+    return NULL;
   }
+  return resize_row_kernels[src_format][dst_format];
 }
 
 __WEAK void image_resize(const uint8_t *src,
@@ -322,10 +626,13 @@ __WEAK void image_resize(const uint8_t *src,
                          int dst_height,
                          image_format_t src_format,
                          image_format_t dst_format) {
-  int src_bpp = (src_format == IMAGE_FORMAT_GRAYSCALE) ? 1 :
-                (src_format == IMAGE_FORMAT_RGB565)    ? 2 : 3;
-  int dst_bpp = (dst_format == IMAGE_FORMAT_GRAYSCALE) ? 1 :
-                (dst_format == IMAGE_FORMAT_RGB565)    ? 2 : 3;
+  resize_row_func_t resize_row = resize_row_kernel(src_format, dst_format);
+  if (resize_row == NULL) {
+    return; // unsupported format
+  }
+
+  int src_bpp = format_bpp(src_format);
+  int dst_bpp = format_bpp(dst_format);
 
   int x_ratio = ((src_width - 1) << FP_SHIFT) / (dst_width - 1);
   int y_ratio = ((src_height - 1) << FP_SHIFT) / (dst_height - 1);
@@ -336,43 +643,296 @@ __WEAK void image_resize(const uint8_t *src,
     int y1 = (y0 < src_height - 1) ? y0 + 1 : y0;
     int wy = src_y_fp & FP_MASK;
 
+    resize_row(&src[y0 * src_width * src_bpp],
+               &src[y1 * src_width * src_bpp],
+               wy,
+               src_width,
+               &dst[y * dst_width * dst_bpp],
+               dst_width,
+               x_ratio,
+               NULL);
+  }
+}
+
+/*
+  Decimate row kernel.
+
+  Computes one output row as the rounded average of factor x factor source
+  pixel blocks. Source rows are read sequentially, one block row at a time.
+
+  \param[in]  src_row     Pointer to the first source row of the block row.
+  \param[in]  src_stride  Source image line size in bytes.
+  \param[out] dst_row     Pointer to the destination row.
+  \param[in]  dst_width   Width of the destination image in pixels.
+  \param[in]  factor      Decimation factor.
+  \param[in]  shift       log2(factor × factor).
+*/
+typedef void (*decimate_row_func_t)(const uint8_t *src_row,
+                                    int src_stride,
+                                    uint8_t *dst_row,
+                                    int dst_width,
+                                    int factor,
+                                    int shift);
+
+/* Define decimate row kernel for a (source format, destination format) pair */
+#define DEFINE_DECIMATE_ROW(SRC, DST)                                           \
+static void decimate_row_##SRC##_##DST(const uint8_t *src_row,                 \
+                                       int src_stride,                          \
+                                       uint8_t *dst_row,                        \
+                                       int dst_width,                           \
+                                       int factor,                              \
+                                       int shift) {                             \
+  const int rnd = (1 << shift) >> 1;                                            \
+  for (int x = 0; x < dst_width; ++x) {                                         \
+    const uint8_t *blk = &src_row[x * factor * BPP_##SRC];                      \
+    int r_sum = 0, g_sum = 0, b_sum = 0;                                        \
+    for (int j = 0; j < factor; ++j) {                                          \
+      const uint8_t *p = &blk[j * src_stride];                                  \
+      for (int i = 0; i < factor; ++i) {                                        \
+        int r_, g_, b_;                                                         \
+        UNPACK_##SRC(&p[i * BPP_##SRC], r_, g_, b_);                            \
+        r_sum += r_;                                                            \
+        g_sum += g_;                                                            \
+        b_sum += b_;                                                            \
+      }                                                                         \
+    }                                                                           \
+    PACK_##DST(&dst_row[x * BPP_##DST],                                         \
+               (r_sum + rnd) >> shift,                                          \
+               (g_sum + rnd) >> shift,                                          \
+               (b_sum + rnd) >> shift);                                         \
+  }                                                                             \
+}
+
+DEFINE_DECIMATE_ROW(GRAYSCALE, GRAYSCALE)
+DEFINE_DECIMATE_ROW(GRAYSCALE, RGB565)
+DEFINE_DECIMATE_ROW(GRAYSCALE, RGB888)
+DEFINE_DECIMATE_ROW(RGB565,    GRAYSCALE)
+DEFINE_DECIMATE_ROW(RGB565,    RGB565)
+DEFINE_DECIMATE_ROW(RGB565,    RGB888)
+DEFINE_DECIMATE_ROW(RGB888,    GRAYSCALE)
+DEFINE_DECIMATE_ROW(RGB888,    RGB565)
+DEFINE_DECIMATE_ROW(RGB888,    RGB888)
+
+/* Decimate row kernels indexed by [src_format][dst_format] */
+static const decimate_row_func_t decimate_row_kernels[3][3] = {
+  { decimate_row_GRAYSCALE_GRAYSCALE, decimate_row_GRAYSCALE_RGB565, decimate_row_GRAYSCALE_RGB888 },
+  { decimate_row_RGB565_GRAYSCALE,    decimate_row_RGB565_RGB565,    decimate_row_RGB565_RGB888    },
+  { decimate_row_RGB888_GRAYSCALE,    decimate_row_RGB888_RGB565,    decimate_row_RGB888_RGB888    }
+};
+
+__WEAK void image_decimate(const uint8_t *src,
+                           int src_width,
+                           int src_height,
+                           uint8_t *dst,
+                           int factor,
+                           image_format_t src_format,
+                           image_format_t dst_format) {
+  int shift = decimation_shift(factor);
+  if ((shift == 0) || (resize_row_kernel(src_format, dst_format) == NULL)) {
+    return; // unsupported factor or format
+  }
+
+  decimate_row_func_t decimate_row = decimate_row_kernels[src_format][dst_format];
+
+  int src_stride = src_width * format_bpp(src_format);
+  int dst_width  = src_width  / factor;
+  int dst_height = src_height / factor;
+  int dst_stride = dst_width * format_bpp(dst_format);
+
+  for (int y = 0; y < dst_height; ++y) {
+    decimate_row(&src[y * factor * src_stride],
+                 src_stride,
+                 &dst[y * dst_stride],
+                 dst_width,
+                 factor,
+                 2 * shift);
+  }
+}
+
+__WEAK int image_decimation_factor(int src_width,
+                                   int src_height,
+                                   int dst_width,
+                                   int dst_height) {
+  for (int factor = 2; factor <= 8; factor *= 2) {
+    if ((src_width == dst_width * factor) && (src_height == dst_height * factor)) {
+      return factor;
+    }
+  }
+  return 0;
+}
+
+__WEAK void image_luma_thumbnail(const uint8_t *src,
+                                 int src_width,
+                                 int src_height,
+                                 image_format_t format,
+                                 uint8_t *dst,
+                                 int factor,
+                                 int is_signed) {
+  const int shift = decimation_shift(factor);
+  if (shift == 0) {
+    return; // unsupported factor
+  }
+
+  const int bpp        = (format == IMAGE_FORMAT_GRAYSCALE) ? 1 : 3;
+  const int dst_width  = src_width  >> shift;
+  const int dst_height = src_height >> shift;
+  const int src_stride = src_width * bpp;
+  const uint8_t mask   = is_signed ? 0x80U : 0x00U;
+
+  /* Block sum of R + 2G + B (4Y for grayscale), averaged over factor^2 pixels and divided by 4 */
+  const int out_shift = 2 * shift + 2;
+  const uint32_t round = 1U << (out_shift - 1);
+
+  for (int y = 0; y < dst_height; ++y) {
+    const uint8_t *block = &src[(y << shift) * src_stride];
     for (int x = 0; x < dst_width; ++x) {
-      int src_x_fp = x * x_ratio;
-      int x0 = src_x_fp >> FP_SHIFT;
-      int x1 = (x0 < src_width - 1) ? x0 + 1 : x0;
-      int wx = src_x_fp & FP_MASK;
-
-      int r00, g00, b00;
-      int r01, g01, b01;
-      int r10, g10, b10;
-      int r11, g11, b11;
-
-      const uint8_t *p00 = &src[(y0 * src_width + x0) * src_bpp];
-      const uint8_t *p01 = &src[(y0 * src_width + x1) * src_bpp];
-      const uint8_t *p10 = &src[(y1 * src_width + x0) * src_bpp];
-      const uint8_t *p11 = &src[(y1 * src_width + x1) * src_bpp];
-
-      unpack_pixel(p00, src_format, &r00, &g00, &b00);
-      unpack_pixel(p01, src_format, &r01, &g01, &b01);
-      unpack_pixel(p10, src_format, &r10, &g10, &b10);
-      unpack_pixel(p11, src_format, &r11, &g11, &b11);
-
-      // Interpolate each channel
-      int r_top = ((FP_ONE - wx) * r00 + wx * r01) >> FP_SHIFT;
-      int r_bot = ((FP_ONE - wx) * r10 + wx * r11) >> FP_SHIFT;
-      int r = ((FP_ONE - wy) * r_top + wy * r_bot) >> FP_SHIFT;
-
-      int g_top = ((FP_ONE - wx) * g00 + wx * g01) >> FP_SHIFT;
-      int g_bot = ((FP_ONE - wx) * g10 + wx * g11) >> FP_SHIFT;
-      int g = ((FP_ONE - wy) * g_top + wy * g_bot) >> FP_SHIFT;
-
-      int b_top = ((FP_ONE - wx) * b00 + wx * b01) >> FP_SHIFT;
-      int b_bot = ((FP_ONE - wx) * b10 + wx * b11) >> FP_SHIFT;
-      int b = ((FP_ONE - wy) * b_top + wy * b_bot) >> FP_SHIFT;
-
-      uint8_t *dst_pixel = &dst[(y * dst_width + x) * dst_bpp];
-      pack_pixel(dst_pixel, dst_format, r, g, b);
+      uint32_t sum = 0;
+      const uint8_t *row = block;
+      for (int j = 0; j < factor; ++j) {
+        if (bpp == 1) {
+          for (int i = 0; i < factor; ++i) {
+            sum += 4U * (uint32_t)(row[i] ^ mask);
+          }
+        } else {
+          for (int i = 0; i < factor * 3; i += 3) {
+            sum += (uint32_t)(row[i] ^ mask) + 2U * (uint32_t)(row[i + 1] ^ mask) + (uint32_t)(row[i + 2] ^ mask);
+          }
+        }
+        row += src_stride;
+      }
+      dst[y * dst_width + x] = (uint8_t)((sum + round) >> out_shift);
+      block += factor * bpp;
+    }
+  }
+}
+
+__WEAK void image_to_int8(uint8_t *buf, int size) {
+  for (int i = 0; i < size; ++i) {
+    buf[i] ^= 0x80U;
+  }
+}
+
+__WEAK void image_gray_to_rgb888(const uint8_t *src,
+                                 int src_stride,
+                                 uint8_t *dst,
+                                 int dst_stride,
+                                 int width,
+                                 int height,
+                                 int is_signed) {
+  const uint8_t mask = is_signed ? 0x80U : 0x00U;
+
+  for (int y = 0; y < height; ++y) {
+    const uint8_t *src_row = &src[y * src_stride];
+    uint8_t *dst_row = &dst[y * dst_stride];
+
+    for (int x = 0; x < width; ++x) {
+      const uint8_t v = src_row[x] ^ mask;
+      dst_row[x * 3 + 0] = v;
+      dst_row[x * 3 + 1] = v;
+      dst_row[x * 3 + 2] = v;
+    }
+  }
+}
+
+__WEAK uint32_t image_sad(const uint8_t *a, const uint8_t *b, int size) {
+  uint32_t sad = 0;
+
+  for (int i = 0; i < size; ++i) {
+    sad += (uint32_t)((a[i] > b[i]) ? (a[i] - b[i]) : (b[i] - a[i]));
+  }
+  return sad;
+}
+
+__WEAK int image_blit_clip(const image_blit_t *blit, image_blit_t *clipped) {
+  /* Visible part of the source in source coordinates */
+  int x0 = (blit->dst_x < 0) ? -blit->dst_x : 0;
+  int y0 = (blit->dst_y < 0) ? -blit->dst_y : 0;
+  int x1 = blit->src_width;
+  int y1 = blit->src_height;
+
+  if (x1 > blit->dst_width - blit->dst_x) {
+    x1 = blit->dst_width - blit->dst_x;
+  }
+  if (y1 > blit->dst_height - blit->dst_y) {
+    y1 = blit->dst_height - blit->dst_y;
+  }
+  if ((x1 <= x0) || (y1 <= y0)) {
+    return 0;
+  }
+
+  *clipped = *blit;
+  clipped->src        = blit->src + y0 * blit->src_stride + x0 * blit->bpp;
+  clipped->src_width  = x1 - x0;
+  clipped->src_height = y1 - y0;
+  clipped->dst        = blit->dst + (blit->dst_y + y0) * blit->dst_stride + (blit->dst_x + x0) * blit->bpp;
+  clipped->dst_width  = x1 - x0;
+  clipped->dst_height = y1 - y0;
+  clipped->dst_x      = 0;
+  clipped->dst_y      = 0;
+  return 1;
+}
+
+__WEAK void image_blit(const image_blit_t *blit) {
+  image_blit_t clipped;
+
+  if (image_blit_clip(blit, &clipped) == 0) {
+    return; // nothing visible
+  }
+
+  const size_t row_bytes = (size_t)clipped.src_width * (size_t)clipped.bpp;
+  const uint8_t *src = clipped.src;
+  uint8_t *dst = clipped.dst;
+
+  if ((row_bytes == (size_t)clipped.src_stride) && (row_bytes == (size_t)clipped.dst_stride)) {
+    /* Both images are contiguous, copy in one go */
+    memcpy(dst, src, row_bytes * (size_t)clipped.src_height);
+    return;
+  }
+
+  for (int y = 0; y < clipped.src_height; ++y) {
+    memcpy(dst, src, row_bytes);
+    src += clipped.src_stride;
+    dst += clipped.dst_stride;
+  }
+}
+
+__WEAK int image_blit_async(const image_blit_t *blit, image_blit_callback_t callback, void *arg) {
+  /* No DMA available, copy synchronously */
+  image_blit(blit);
+
+  if (callback != NULL) {
+    callback(0, arg);
+  }
+  return 0;
+}
+
+__WEAK void image_fill_rgb888(uint8_t *dst, int stride, int width, int height, uint32_t color) {
+  if ((width <= 0) || (height <= 0)) {
+    return;
+  }
+
+  /* Four pixels repeat every three words */
+  const uint8_t px[3] = { (uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color };
+  uint8_t pattern[12];
+  for (int i = 0; i < 12; ++i) {
+    pattern[i] = px[i % 3];
+  }
+
+  for (int y = 0; y < height; ++y) {
+    uint8_t *row = dst;
+    int x = 0;
+
+    for (; x <= width - 4; x += 4) {
+      memcpy(row, pattern, sizeof(pattern));
+      row += sizeof(pattern);
     }
+    for (; x < width; ++x) {
+      row[0] = px[0];
+      row[1] = px[1];
+      row[2] = px[2];
+      row += 3;
+    }
+    dst += stride;
   }
 }
 
@@ -385,40 +945,28 @@ __WEAK void image_copy_to_framebuffer(const uint8_t *src,
                                       int x_offset,
                                       int y_offset,
                                       image_format_t format) {
-  int bpp;
-
-  switch (format) {
-    case IMAGE_FORMAT_GRAYSCALE:
-      bpp = 1;
-      break;
-    case IMAGE_FORMAT_RGB565:
-      bpp = 2;
-      break;
-    case IMAGE_FORMAT_RGB888:
-      bpp = 3;
-      break;
-    default:
-      return; // unsupported format
+  if ((format != IMAGE_FORMAT_GRAYSCALE) &&
+      (format != IMAGE_FORMAT_RGB565)    &&
+      (format != IMAGE_FORMAT_RGB888)) {
+    return; // unsupported format
   }
 
-  for (int y = 0; y < src_height; ++y) {
-    int dst_y = y + y_offset;
-    if (dst_y < 0 || dst_y >= dst_height)
-      continue;
-
-    for (int x = 0; x < src_width; ++x) {
-      int dst_x = x + x_offset;
-      if (dst_x < 0 || dst_x >= dst_width)
-        continue;
+  const int bpp = format_bpp(format);
+  const image_blit_t blit = {
+    .src        = src,
+    .src_width  = src_width,
+    .src_height = src_height,
+    .src_stride = src_width * bpp,
+    .dst        = dst,
+    .dst_width  = dst_width,
+    .dst_height = dst_height,
+    .dst_stride = dst_width * bpp,
+    .dst_x      = x_offset,
+    .dst_y      = y_offset,
+    .bpp        = bpp
+  };
 
-      int src_idx = (y * src_width + x) * bpp;
-      int dst_idx = (dst_y * dst_width + dst_x) * bpp;
-
-      for (int i = 0; i < bpp; ++i) {
-        dst[dst_idx + i] = src[src_idx + i];
-      }
-    }
-  }
+  image_blit(&blit);
 }
 
 __WEAK void convert_rgb565_to_rgb888(const uint8_t *src,
@@ -512,3 +1060,598 @@ __WEAK void crop_rgb888_to_rgb888(const uint8_t *src,
     }
   }
 }
+
+/*
+  Convert YUV sample to RGB (ITU-R BT.601, limited range).
+
+  \param[in]  y  Luma sample.
+  \param[in]  u  Blue-difference chroma sample.
+  \param[in]  v  Red-difference chroma sample.
+  \param[out] r  Red component.
+  \param[out] g  Green component.
+  \param[out] b  Blue component.
+*/
+static inline void yuv_to_rgb(int y, int u, int v, int *r, int *g, int *b) {
+  int c = 298 * (y - 16) + 128;
+  int d = u - 128;
+  int e = v - 128;
+
+  *r = clamp((c + 409 * e) >> 8, 0, 255);
+  *g = clamp((c - 100 * d - 208 * e) >> 8, 0, 255);
+  *b = clamp((c + 516 * d) >> 8, 0, 255);
+}
+
+/* Convert one output row from YUV 4:2:0 (nearest sample) for a destination format */
+#define YUV420_ROW(DST, y_row, u_row, v_row, c_step, dst_row, dst_width, sx0, x_step) \
+  do {                                                                          \
+    int sx_fp_ = (sx0) << FP_SHIFT;                                             \
+    for (int dx_ = 0; dx_ < (dst_width); ++dx_) {                               \
+      int sx_ = sx_fp_ >> FP_SHIFT;                                             \
+      int cx_ = (sx_ >> 1) * (c_step);                                          \
+      int r_, g_, b_;                                                           \
+      yuv_to_rgb((y_row)[sx_], (u_row)[cx_], (v_row)[cx_], &r_, &g_, &b_);      \
+      PACK_##DST(&(dst_row)[dx_ * BPP_##DST], r_, g_, b_);                      \
+      sx_fp_ += (x_step);                                                       \
+    }                                                                           \
+  } while (0)
+
+__WEAK void crop_and_resize_yuv420(const uint8_t *src,
+                                   int src_width,
+                                   int src_height,
+                                   int src_crop_x,
+                                   int src_crop_y,
+                                   int crop_width,
+                                   int crop_height,
+                                   uint8_t *dst,
+                                   int dst_width,
+                                   int dst_height,
+                                   yuv_format_t yuv_format,
+                                   image_format_t dst_format) {
+  const int c_width  = (src_width  + 1) / 2;
+  const int c_height = (src_height + 1) / 2;
+  const uint8_t *y_plane = src;
+  const uint8_t *u_plane;
+  const uint8_t *v_plane;
+  int c_step;     // distance between chroma samples of the same plane
+  int c_stride;   // chroma line size in bytes
+
+  switch (yuv_format) {
+    case YUV_FORMAT_I420:
+      u_plane  = src + src_width * src_height;
+      v_plane  = u_plane + c_width * c_height;
+      c_step   = 1;
+      c_stride = c_width;
+      break;
+    case YUV_FORMAT_NV12:
+      u_plane  = src + src_width * src_height;
+      v_plane  = u_plane + 1;
+      c_step   = 2;
+      c_stride = c_width * 2;
+      break;
+    case YUV_FORMAT_NV21:
+      v_plane  = src + src_width * src_height;
+      u_plane  = v_plane + 1;
+      c_step   = 2;
+      c_stride = c_width * 2;
+      break;
+    default:
+      return; // unsupported format
+  }
+
+  if ((dst_format != IMAGE_FORMAT_GRAYSCALE) &&
+      (dst_format != IMAGE_FORMAT_RGB565)    &&
+      (dst_format != IMAGE_FORMAT_RGB888)) {
+    return; // unsupported format
+  }
+
+  const int x_step = (crop_width << FP_SHIFT) / dst_width;
+  const int dst_stride = dst_width * format_bpp(dst_format);
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    const int sy = src_crop_y + (dy * crop_height) / dst_height;
+    const uint8_t *y_row = y_plane + sy * src_width;
+    uint8_t *dst_row = dst + dy * dst_stride;
+
+    if (dst_format == IMAGE_FORMAT_GRAYSCALE) {
+      /* Luma only, chroma planes are not read. Expanding the limited range
+         gives the luma of the RGB conversion for neutral chroma */
+      int sx_fp = src_crop_x << FP_SHIFT;
+      for (int dx = 0; dx < dst_width; ++dx) {
+        dst_row[dx] = (uint8_t)clamp((298 * (y_row[sx_fp >> FP_SHIFT] - 16) + 128) >> 8, 0, 255);
+        sx_fp += x_step;
+      }
+      continue;
+    }
+
+    const uint8_t *u_row = u_plane + (sy >> 1) * c_stride;
+    const uint8_t *v_row = v_plane + (sy >> 1) * c_stride;
+
+    if (dst_format == IMAGE_FORMAT_RGB888) {
+      YUV420_ROW(RGB888, y_row, u_row, v_row, c_step, dst_row, dst_width, src_crop_x, x_step);
+    } else {
+      YUV420_ROW(RGB565, y_row, u_row, v_row, c_step, dst_row, dst_width, src_crop_x, x_step);
+    }
+  }
+}
+
+__WEAK void image_debayer_stream_init(image_debayer_stream_t *stream,
+                                      int width,
+                                      int height,
+                                      bayer_pattern_t pattern,
+                                      int swap_rb,
+                                      uint8_t *line_buf,
+                                      uint8_t *out_row,
+                                      image_row_callback_t callback,
+                                      void *arg) {
+  stream->width    = width;
+  stream->height   = height;
+  stream->swap_rb  = swap_rb;
+  stream->line_buf = line_buf;
+  stream->out_row  = out_row;
+  stream->src_y    = 0;
+  stream->callback = callback;
+  stream->arg      = arg;
+
+  bayer_offsets(pattern, stream->offsets);
+}
+
+__WEAK int image_debayer_stream_push(image_debayer_stream_t *stream,
+                                     const uint8_t *rows,
+                                     int num_rows) {
+  const int width = stream->width;
+  int emitted = 0;
+
+  for (int i = 0; (i < num_rows) && (stream->src_y < stream->height); ++i) {
+    int y = stream->src_y++;
+
+    /* Store source row into the rolling line buffer */
+    memcpy(&stream->line_buf[(y % IMAGE_DEBAYER_STREAM_LINES) * width], &rows[i * width], (size_t)width);
+
+    if (y >= 1) {
+      /* Neighbourhood of row y-1 is complete (row -1 mirrors row 1) */
+      const int ya = (y == 1) ? 1 : (y - 2);
+
+      debayer_row(&stream->line_buf[(ya      % IMAGE_DEBAYER_STREAM_LINES) * width],
+                  &stream->line_buf[((y - 1) % IMAGE_DEBAYER_STREAM_LINES) * width],
+                  &stream->line_buf[( y      % IMAGE_DEBAYER_STREAM_LINES) * width],
+                  stream->out_row,
+                  width,
+                  y - 1,
+                  stream->offsets,
+                  stream->swap_rb);
+
+      stream->callback(stream->out_row, y - 1, stream->arg);
+      emitted++;
+    }
+
+    if (y == stream->height - 1) {
+      /* Last row, row height mirrors row height-2 */
+      debayer_row(&stream->line_buf[((y - 1) % IMAGE_DEBAYER_STREAM_LINES) * width],
+                  &stream->line_buf[( y      % IMAGE_DEBAYER_STREAM_LINES) * width],
+                  &stream->line_buf[((y - 1) % IMAGE_DEBAYER_STREAM_LINES) * width],
+                  stream->out_row,
+                  width,
+                  y,
+                  stream->offsets,
+                  stream->swap_rb);
+
+      stream->callback(stream->out_row, y, stream->arg);
+      emitted++;
+    }
+  }
+  return emitted;
+}
+
+__WEAK void crop_and_debayer_stream_init(crop_and_debayer_stream_t *stream,
+                                         int src_width,
+                                         int src_height,
+                                         int src_crop_x,
+                                         int src_crop_y,
+                                         int dst_width,
+                                         int dst_height,
+                                         bayer_pattern_t pattern,
+                                         uint8_t *line_buf,
+                                         uint8_t *out_row,
+                                         image_row_callback_t callback,
+                                         void *arg) {
+  stream->src_width  = src_width;
+  stream->src_height = src_height;
+  stream->src_crop_x = src_crop_x;
+  stream->src_crop_y = src_crop_y;
+  stream->dst_width  = dst_width;
+  stream->dst_height = dst_height;
+  stream->line_buf   = line_buf;
+  stream->out_row    = out_row;
+  stream->src_y      = 0;
+  stream->dst_y      = 0;
+  stream->callback   = callback;
+  stream->arg        = arg;
+
+  bayer_offsets(pattern, stream->offsets);
+}
+
+__WEAK int crop_and_debayer_stream_push(crop_and_debayer_stream_t *stream,
+                                        const uint8_t *rows,
+                                        int num_rows) {
+  const int width = stream->src_width;
+  int emitted = 0;
+
+  for (int i = 0; (i < num_rows) && (stream->src_y < stream->src_height); ++i) {
+    int y = stream->src_y++;
+
+    /* Store source row into the rolling line buffer */
+    memcpy(&stream->line_buf[(y % IMAGE_DEBAYER_STREAM_LINES) * width], &rows[i * width], (size_t)width);
+
+    /* Emit all output rows whose neighbourhood is complete */
+    while (stream->dst_y < stream->dst_height) {
+      int sy = crop_src_row(stream->dst_y, stream->src_height, stream->src_crop_y, stream->dst_height);
+      if ((sy + 1) > y) {
+        break;
+      }
+
+      crop_and_debayer_row(&stream->line_buf[((sy - 1) % IMAGE_DEBAYER_STREAM_LINES) * width],
+                           &stream->line_buf[( sy      % IMAGE_DEBAYER_STREAM_LINES) * width],
+                           &stream->line_buf[((sy + 1) % IMAGE_DEBAYER_STREAM_LINES) * width],
+                           sy,
+                           width,
+                           stream->src_crop_x,
+                           stream->out_row,
+                           stream->dst_width,
+                           (const int (*)[2])stream->offsets,
+                           0x00U,
+                           NULL);
+
+      stream->callback(stream->out_row, stream->dst_y, stream->arg);
+      stream->dst_y++;
+      emitted++;
+    }
+  }
+  return emitted;
+}
+
+__WEAK void image_resize_stream_init(image_resize_stream_t *stream,
+                                     int src_width,
+                                     int src_height,
+                                     int dst_width,
+                                     int dst_height,
+                                     image_format_t src_format,
+                                     image_format_t dst_format,
+                                     uint8_t *line_buf,
+                                     uint8_t *out_row,
+                                     image_row_callback_t callback,
+                                     void *arg) {
+  stream->src_width  = src_width;
+  stream->src_height = src_height;
+  stream->dst_width  = dst_width;
+  stream->dst_height = dst_height;
+  stream->src_format = src_format;
+  stream->dst_format = dst_format;
+  stream->x_ratio    = ((src_width - 1) << FP_SHIFT) / (dst_width - 1);
+  stream->y_ratio    = ((src_height - 1) << FP_SHIFT) / (dst_height - 1);
+  stream->line_buf   = line_buf;
+  stream->out_row    = out_row;
+  stream->src_y      = 0;
+  stream->dst_y      = 0;
+  stream->callback   = callback;
+  stream->arg        = arg;
+}
+
+__WEAK int image_resize_stream_push(image_resize_stream_t *stream,
+                                    const uint8_t *rows,
+                                    int num_rows) {
+  const resize_row_func_t resize_row = resize_row_kernel(stream->src_format, stream->dst_format);
+  const int line_size = stream->src_width * format_bpp(stream->src_format);
+  int emitted = 0;
+
+  if (resize_row == NULL) {
+    return 0; // unsupported format
+  }
+
+  for (int i = 0; (i < num_rows) && (stream->src_y < stream->src_height); ++i) {
+    int y = stream->src_y++;
+
+    /* Store source row into the rolling line buffer */
+    memcpy(&stream->line_buf[(y % IMAGE_RESIZE_STREAM_LINES) * line_size], &rows[i * line_size], (size_t)line_size);
+
+    /* Emit all output rows whose source rows are available */
+    while (stream->dst_y < stream->dst_height) {
+      int src_y_fp = stream->dst_y * stream->y_ratio;
+      int y0 = src_y_fp >> FP_SHIFT;
+      int y1 = (y0 < stream->src_height - 1) ? y0 + 1 : y0;
+      int wy = src_y_fp & FP_MASK;
+
+      if (y1 > y) {
+        break;
+      }
+
+      resize_row(&stream->line_buf[(y0 % IMAGE_RESIZE_STREAM_LINES) * line_size],
+                 &stream->line_buf[(y1 % IMAGE_RESIZE_STREAM_LINES) * line_size],
+                 wy,
+                 stream->src_width,
+                 stream->out_row,
+                 stream->dst_width,
+                 stream->x_ratio,
+                 NULL);
+
+      stream->callback(stream->out_row, stream->dst_y, stream->arg);
+      stream->dst_y++;
+      emitted++;
+    }
+  }
+  return emitted;
+}
+
+__WEAK void crop_and_debayer_plan_init(crop_and_debayer_plan_t *plan,
+                                       uint16_t *buf,
+                                       int src_width,
+                                       int src_height,
+                                       int src_crop_x,
+                                       int src_crop_y,
+                                       int dst_width,
+                                       int dst_height) {
+  plan->src_width  = src_width;
+  plan->src_height = src_height;
+  plan->dst_width  = dst_width;
+  plan->dst_height = dst_height;
+  plan->col_idx    = &buf[0];
+  plan->row_idx    = &buf[dst_width];
+
+  for (int dx = 0; dx < dst_width; ++dx) {
+    plan->col_idx[dx] = (uint16_t)crop_src_col(dx, src_width, src_crop_x, dst_width);
+  }
+  for (int dy = 0; dy < dst_height; ++dy) {
+    plan->row_idx[dy] = (uint16_t)crop_src_row(dy, src_height, src_crop_y, dst_height);
+  }
+}
+
+/*
+  Get source index sampled for an output index within a window.
+
+  \param[in]  d        Index of the output column or row.
+  \param[in]  win_pos  Offset of the window in the source image.
+  \param[in]  win_len  Length of the window in pixels.
+  \param[in]  src_len  Length of the source image in pixels.
+  \param[in]  dst_len  Length of the output image in pixels.
+  \return              Index of the source column or row (1 to src_len-2).
+*/
+static int window_src_idx(int d, int win_pos, int win_len, int src_len, int dst_len) {
+  int s = (dst_len > 1) ? (d * (win_len - 1)) / (dst_len - 1) : 0;
+
+  return clamp(s + win_pos, 1, src_len - 2);
+}
+
+__WEAK void crop_and_debayer_window_plan_init(crop_and_debayer_plan_t *plan,
+                                              uint16_t *buf,
+                                              int src_width,
+                                              int src_height,
+                                              int win_x,
+                                              int win_y,
+                                              int win_width,
+                                              int win_height,
+                                              int dst_width,
+                                              int dst_height) {
+  plan->src_width  = src_width;
+  plan->src_height = src_height;
+  plan->dst_width  = dst_width;
+  plan->dst_height = dst_height;
+  plan->col_idx    = &buf[0];
+  plan->row_idx    = &buf[dst_width];
+
+  for (int dx = 0; dx < dst_width; ++dx) {
+    plan->col_idx[dx] = (uint16_t)window_src_idx(dx, win_x, win_width, src_width, dst_width);
+  }
+  for (int dy = 0; dy < dst_height; ++dy) {
+    plan->row_idx[dy] = (uint16_t)window_src_idx(dy, win_y, win_height, src_height, dst_height);
+  }
+}
+
+__WEAK void crop_and_debayer_planned(const crop_and_debayer_plan_t *plan,
+                                     const uint8_t *src,
+                                     void *dst,
+                                     bayer_pattern_t pattern,
+                                     int is_signed) {
+  const int src_width = plan->src_width;
+  const int dst_width = plan->dst_width;
+  int offsets[2][2];
+
+  bayer_offsets(pattern, offsets);
+
+  for (int dy = 0; dy < plan->dst_height; ++dy) {
+    int sy = plan->row_idx[dy];
+
+    crop_and_debayer_row(&src[(sy - 1) * src_width],
+                         &src[sy * src_width],
+                         &src[(sy + 1) * src_width],
+                         sy,
+                         src_width,
+                         0,
+                         &((uint8_t *)dst)[dy * dst_width * 3],
+                         dst_width,
+                         (const int (*)[2])offsets,
+                         (is_signed != 0) ? 0x80U : 0x00U,
+                         plan->col_idx);
+  }
+}
+
+/* Number of output pixels debayered at once into grayscale */
+#define DEBAYER_GRAY_CHUNK  32
+
+/*
+  Crop, scale and debayer one output row into grayscale.
+
+  The row is debayered into RGB in chunks, which are then reduced to luma.
+  Parameters are the same as for crop_and_debayer_row, except that dst_row
+  points to the output grayscale row.
+*/
+static void crop_and_debayer_gray_row(const uint8_t *above,
+                                      const uint8_t *cur,
+                                      const uint8_t *below,
+                                      int sy,
+                                      int src_width,
+                                      int src_crop_x,
+                                      uint8_t *dst_row,
+                                      int dst_width,
+                                      const int offsets[2][2],
+                                      uint8_t mask,
+                                      const uint16_t *cols) {
+  uint8_t  rgb[DEBAYER_GRAY_CHUNK * 3];
+  uint16_t chunk_cols[DEBAYER_GRAY_CHUNK];
+
+  for (int dx = 0; dx < dst_width; dx += DEBAYER_GRAY_CHUNK) {
+    const int cnt = (dst_width - dx < DEBAYER_GRAY_CHUNK) ? (dst_width - dx) : DEBAYER_GRAY_CHUNK;
+
+    if (cols == NULL) {
+      for (int i = 0; i < cnt; ++i) {
+        chunk_cols[i] = (uint16_t)crop_src_col(dx + i, src_width, src_crop_x, dst_width);
+      }
+    }
+
+    crop_and_debayer_row(above,
+                         cur,
+                         below,
+                         sy,
+                         src_width,
+                         src_crop_x,
+                         rgb,
+                         cnt,
+                         offsets,
+                         0x00U,
+                         (cols != NULL) ? &cols[dx] : chunk_cols);
+
+    for (int i = 0; i < cnt; ++i) {
+      PACK_GRAYSCALE(&dst_row[dx + i], rgb[i * 3 + 0], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+      dst_row[dx + i] ^= mask;
+    }
+  }
+}
+
+__WEAK void crop_and_debayer_to_input(const uint8_t *src,
+                                      int src_width,
+                                      int src_height,
+                                      int src_crop_x,
+                                      int src_crop_y,
+                                      void *dst,
+                                      int dst_width,
+                                      int dst_height,
+                                      bayer_pattern_t pattern,
+                                      image_format_t dst_format,
+                                      int is_signed) {
+  const uint8_t mask = (is_signed != 0) ? 0x80U : 0x00U;
+  int offsets[2][2];
+
+  if (dst_format == IMAGE_FORMAT_RGB888) {
+    crop_and_debayer_xor(src, src_width, src_height, src_crop_x, src_crop_y,
+                         (uint8_t *)dst, dst_width, dst_height, pattern, mask);
+    return;
+  }
+  if (dst_format != IMAGE_FORMAT_GRAYSCALE) {
+    return; // unsupported format
+  }
+
+  bayer_offsets(pattern, offsets);
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    const int sy = crop_src_row(dy, src_height, src_crop_y, dst_height);
+
+    crop_and_debayer_gray_row(&src[(sy - 1) * src_width],
+                              &src[sy * src_width],
+                              &src[(sy + 1) * src_width],
+                              sy,
+                              src_width,
+                              src_crop_x,
+                              &((uint8_t *)dst)[dy * dst_width],
+                              dst_width,
+                              (const int (*)[2])offsets,
+                              mask,
+                              NULL);
+  }
+}
+
+__WEAK void crop_and_debayer_planned_gray(const crop_and_debayer_plan_t *plan,
+                                          const uint8_t *src,
+                                          uint8_t *dst,
+                                          bayer_pattern_t pattern,
+                                          int is_signed) {
+  const int src_width = plan->src_width;
+  const int dst_width = plan->dst_width;
+  int offsets[2][2];
+
+  bayer_offsets(pattern, offsets);
+
+  for (int dy = 0; dy < plan->dst_height; ++dy) {
+    const int sy = plan->row_idx[dy];
+
+    crop_and_debayer_gray_row(&src[(sy - 1) * src_width],
+                              &src[sy * src_width],
+                              &src[(sy + 1) * src_width],
+                              sy,
+                              src_width,
+                              0,
+                              &dst[dy * dst_width],
+                              dst_width,
+                              (const int (*)[2])offsets,
+                              (is_signed != 0) ? 0x80U : 0x00U,
+                              plan->col_idx);
+  }
+}
+
+__WEAK void image_resize_plan_init(image_resize_plan_t *plan,
+                                   uint16_t *buf,
+                                   int src_width,
+                                   int src_height,
+                                   int dst_width,
+                                   int dst_height) {
+  int x_ratio = ((src_width - 1) << FP_SHIFT) / (dst_width - 1);
+  int y_ratio = ((src_height - 1) << FP_SHIFT) / (dst_height - 1);
+
+  plan->src_width  = src_width;
+  plan->src_height = src_height;
+  plan->dst_width  = dst_width;
+  plan->dst_height = dst_height;
+  plan->col_idx0   = &buf[0];
+  plan->col_idx1   = &buf[dst_width];
+  plan->col_weight = &buf[dst_width * 2];
+  plan->row_idx0   = &buf[dst_width * 3];
+  plan->row_idx1   = &buf[dst_width * 3 + dst_height];
+  plan->row_weight = &buf[dst_width * 3 + dst_height * 2];
+
+  for (int x = 0; x < dst_width; ++x) {
+    int src_x_fp = x * x_ratio;
+    int x0 = src_x_fp >> FP_SHIFT;
+    plan->col_idx0[x]   = (uint16_t)x0;
+    plan->col_idx1[x]   = (uint16_t)((x0 < src_width - 1) ? x0 + 1 : x0);
+    plan->col_weight[x] = (uint16_t)(src_x_fp & FP_MASK);
+  }
+  for (int y = 0; y < dst_height; ++y) {
+    int src_y_fp = y * y_ratio;
+    int y0 = src_y_fp >> FP_SHIFT;
+    plan->row_idx0[y]   = (uint16_t)y0;
+    plan->row_idx1[y]   = (uint16_t)((y0 < src_height - 1) ? y0 + 1 : y0);
+    plan->row_weight[y] = (uint16_t)(src_y_fp & FP_MASK);
+  }
+}
+
+__WEAK void image_resize_planned(const image_resize_plan_t *plan,
+                                 const uint8_t *src,
+                                 uint8_t *dst,
+                                 image_format_t src_format,
+                                 image_format_t dst_format) {
+  resize_row_func_t resize_row = resize_row_kernel(src_format, dst_format);
+  if (resize_row == NULL) {
+    return; // unsupported format
+  }
+
+  const int src_line = plan->src_width * format_bpp(src_format);
+  const int dst_line = plan->dst_width * format_bpp(dst_format);
+
+  for (int y = 0; y < plan->dst_height; ++y) {
+    resize_row(&src[plan->row_idx0[y] * src_line],
+               &src[plan->row_idx1[y] * src_line],
+               plan->row_weight[y],
+               plan->src_width,
+               &dst[y * dst_line],
+               plan->dst_width,
+               0,
+               plan);
+  }
+}
@@ -0,0 +1,528 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Helium (MVE) implementations of the image processing functions.
+
+  Functions in this file override the __WEAK scalar defaults from
+  image_processing_func.c when the target supports the M-profile Vector
+  Extension (Cortex-M55, Cortex-M85). Results are bit-exact with the scalar
+  versions.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cmsis_compiler.h"
+#include "image_processing_func.h"
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+
+#include <arm_mve.h>
+
+/* Number of 16-bit lanes in a vector register */
+#define MVE_LANES_U16   8
+
+/*
+  Crop, scale and debayer a RAW8 Bayer image into an RGB888 or grayscale
+  buffer using MVE.
+
+  Every output byte is XOR-ed with the given mask (0x00 for uint8 output,
+  0x80 for int8 output). Source rows and columns are taken from the plan
+  when provided, otherwise they are computed. Grayscale output is the luma
+  of the debayered colour, with the weights of the scalar conversion.
+*/
+static void crop_and_debayer_mve(const uint8_t *src,
+                                 int src_width,
+                                 int src_height,
+                                 int src_crop_x,
+                                 int src_crop_y,
+                                 uint8_t *dst,
+                                 int dst_width,
+                                 int dst_height,
+                                 bayer_pattern_t pattern,
+                                 int gray,
+                                 uint8_t mask,
+                                 const crop_and_debayer_plan_t *plan) {
+  int offsets[2][2];
+  bayer_offsets(pattern, offsets);
+
+  /* Horizontal sampling step, split into quotient and remainder so the source
+     column of every output pixel is obtained without a per-pixel divide */
+  const int x_span  = (src_width - 2 - src_crop_x * 2) << 8;
+  const int x_den   = dst_width - 1;
+  const int x_step_q = x_span / x_den;
+  const int x_step_r = x_span % x_den;
+
+  /* Byte offsets of the R, G and B components of consecutive output pixels */
+  const uint16x8_t dst_ofs = vmulq_n_u16(vidupq_n_u16(0U, 1), 3U);
+  const uint16x8_t out_mask = vdupq_n_u16(mask);
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    int sy;
+
+    if (plan != NULL) {
+      sy = plan->row_idx[dy];
+    } else {
+      int sy_fp = (dy * (src_height - 2 - src_crop_y * 2) << 8) / (dst_height - 1); // fixed-point
+      sy = sy_fp >> 8;
+
+      sy += src_crop_y;
+      if (sy < 1) {
+        sy = 1;
+      }
+      if (sy >= src_height - 2) {
+        sy = src_height - 2;
+      }
+    }
+
+    const int row_parity = sy & 1;
+    const uint8_t *row_u = src + (sy - 1) * src_width;
+    const uint8_t *row_c = src + sy * src_width;
+    const uint8_t *row_d = src + (sy + 1) * src_width;
+
+    /* Colour site of even and odd source columns on this row */
+    const uint16x8_t off_even = vdupq_n_u16((uint16_t)offsets[row_parity][0]);
+    const uint16x8_t off_odd  = vdupq_n_u16((uint16_t)offsets[row_parity][1]);
+
+    uint8_t *dst_row = dst + dy * dst_width * ((gray != 0) ? 1 : 3);
+
+    int sx_q = 0;
+    int sx_r = 0;
+
+    for (int dx = 0; dx < dst_width; dx += MVE_LANES_U16) {
+      int cnt = dst_width - dx;
+      if (cnt > MVE_LANES_U16) {
+        cnt = MVE_LANES_U16;
+      }
+
+      const mve_pred16_t p = vctp16q((uint32_t)cnt);
+      uint16x8_t sx;
+
+      if (plan != NULL) {
+        sx = vldrhq_z_u16(&plan->col_idx[dx], p);
+      } else {
+        uint16_t sx_tab[MVE_LANES_U16];
+
+        /* Source column for each lane, identical to (dx * span << 8) / (dst_width - 1) */
+        for (int i = 0; i < MVE_LANES_U16; ++i) {
+          int col = (sx_q >> 8) + src_crop_x;
+          if (col < 1) {
+            col = 1;
+          }
+          if (col >= src_width - 2) {
+            col = src_width - 2;
+          }
+          sx_tab[i] = (uint16_t)col;
+
+          sx_q += x_step_q;
+          sx_r += x_step_r;
+          if (sx_r >= x_den) {
+            sx_q += 1;
+            sx_r -= x_den;
+          }
+        }
+        sx = vldrhq_u16(sx_tab);
+      }
+      uint16x8_t sxl = vsubq_n_u16(sx, 1U);
+      uint16x8_t sxr = vaddq_n_u16(sx, 1U);
+
+      uint16x8_t c  = vldrbq_gather_offset_z_u16(row_c, sx,  p);
+      uint16x8_t l  = vldrbq_gather_offset_z_u16(row_c, sxl, p);
+      uint16x8_t r  = vldrbq_gather_offset_z_u16(row_c, sxr, p);
+      uint16x8_t u  = vldrbq_gather_offset_z_u16(row_u, sx,  p);
+      uint16x8_t d  = vldrbq_gather_offset_z_u16(row_d, sx,  p);
+      uint16x8_t ul = vldrbq_gather_offset_z_u16(row_u, sxl, p);
+      uint16x8_t ur = vldrbq_gather_offset_z_u16(row_u, sxr, p);
+      uint16x8_t dl = vldrbq_gather_offset_z_u16(row_d, sxl, p);
+      uint16x8_t dr = vldrbq_gather_offset_z_u16(row_d, sxr, p);
+
+      uint16x8_t horz  = vshrq_n_u16(vaddq_u16(l, r), 1);
+      uint16x8_t vert  = vshrq_n_u16(vaddq_u16(u, d), 1);
+      uint16x8_t cross = vshrq_n_u16(vaddq_u16(vaddq_u16(l, r), vaddq_u16(u, d)), 2);
+      uint16x8_t diag  = vshrq_n_u16(vaddq_u16(vaddq_u16(ul, ur), vaddq_u16(dl, dr)), 2);
+
+      /* Per-lane colour site: 0 = blue, 1 = green, 2 = red */
+      mve_pred16_t p_odd_col = vcmpneq_n_u16(vandq_u16(sx, vdupq_n_u16(1U)), 0U);
+      uint16x8_t   site      = vpselq_u16(off_odd, off_even, p_odd_col);
+      mve_pred16_t p_blue    = vcmpeqq_n_u16(site, 0U);
+      mve_pred16_t p_green   = vcmpeqq_n_u16(site, 1U);
+      mve_pred16_t p_red     = vcmpeqq_n_u16(site, 2U);
+
+      /* Green sites take red from the row neighbours when row and column parity differ */
+      mve_pred16_t p_r_horz = row_parity ? vpnot(p_odd_col) : p_odd_col;
+
+      uint16x8_t out_r = vpselq_u16(c, diag, p_red);
+      uint16x8_t out_b = vpselq_u16(c, diag, p_blue);
+      uint16x8_t out_g = vpselq_u16(c, cross, p_green);
+      out_r = vpselq_u16(vpselq_u16(horz, vert, p_r_horz), out_r, p_green);
+      out_b = vpselq_u16(vpselq_u16(vert, horz, p_r_horz), out_b, p_green);
+
+      if (gray != 0) {
+        /* Y = (77R + 150G + 29B) >> 8, at most 255 * 256 so it fits 16-bit lanes */
+        uint16x8_t luma = vmulq_n_u16(out_r, 77U);
+        luma = vaddq_u16(luma, vmulq_n_u16(out_g, 150U));
+        luma = vaddq_u16(luma, vmulq_n_u16(out_b, 29U));
+        luma = veorq_u16(vshrq_n_u16(luma, 8), out_mask);
+
+        vstrbq_p_u16(dst_row + dx, luma, p);
+        continue;
+      }
+
+      out_r = veorq_u16(out_r, out_mask);
+      out_g = veorq_u16(out_g, out_mask);
+      out_b = veorq_u16(out_b, out_mask);
+
+      uint8_t *dst_px = dst_row + dx * 3;
+      vstrbq_scatter_offset_p_u16(dst_px + 0, dst_ofs, out_r, p);
+      vstrbq_scatter_offset_p_u16(dst_px + 1, dst_ofs, out_g, p);
+      vstrbq_scatter_offset_p_u16(dst_px + 2, dst_ofs, out_b, p);
+    }
+  }
+}
+
+/*
+  Debayer a border pixel (first or last column) with mirrored neighbour column.
+*/
+static void debayer_border_px(const uint8_t *above,
+                              const uint8_t *cur,
+                              const uint8_t *below,
+                              int x,
+                              int xn,
+                              uint8_t *rgb,
+                              int is_green,
+                              int i_own,
+                              int i_other) {
+  uint8_t *px = rgb + x * 3;
+
+  if (is_green != 0) {
+    px[1]       = cur[x];
+    px[i_own]   = cur[xn];
+    px[i_other] = (uint8_t)((above[x] + below[x]) >> 1);
+  } else {
+    px[i_own]   = cur[x];
+    px[1]       = (uint8_t)((2 * cur[xn] + above[x] + below[x]) >> 2);
+    px[i_other] = (uint8_t)((above[xn] + below[xn]) >> 1);
+  }
+}
+
+void image_debayer(const uint8_t *raw,
+                   uint8_t *rgb,
+                   int width,
+                   int height,
+                   bayer_pattern_t pattern,
+                   int swap_rb) {
+  int offsets[2][2];
+  bayer_offsets(pattern, offsets);
+
+  /* Interior chunks start at odd columns, so even lanes hold odd columns */
+  const mve_pred16_t p_even_lane = 0x3333U;
+  const uint16x8_t dst_ofs = vmulq_n_u16(vidupq_n_u16(0U, 1), 3U);
+
+  for (int y = 0; y < height; ++y) {
+    /* Mirror the missing neighbour row at the top and bottom border */
+    const int ya = (y == 0)          ? 1            : (y - 1);
+    const int yb = (y == height - 1) ? (height - 2) : (y + 1);
+
+    const uint8_t *above = raw + ya * width;
+    const uint8_t *cur   = raw + y  * width;
+    const uint8_t *below = raw + yb * width;
+    uint8_t *rgb_row = rgb + y * width * 3;
+
+    const int *site   = offsets[y & 1];
+    const int g_col   = (site[0] == 1) ? 0 : 1;
+    const int colour  = site[g_col ^ 1];
+    const int i_own   = (swap_rb != 0) ? colour : (2 - colour);
+    const int i_other = 2 - i_own;
+
+    /* Lanes holding green sites */
+    const mve_pred16_t p_green = (g_col == 1) ? p_even_lane : vpnot(p_even_lane);
+
+    debayer_border_px(above, cur, below, 0, 1, rgb_row, g_col == 0, i_own, i_other);
+
+    for (int x = 1; x < width - 1; x += MVE_LANES_U16) {
+      int cnt = width - 1 - x;
+      if (cnt > MVE_LANES_U16) {
+        cnt = MVE_LANES_U16;
+      }
+
+      const mve_pred16_t p = vctp16q((uint32_t)cnt);
+
+      uint16x8_t c  = vldrbq_z_u16(cur   + x,     p);
+      uint16x8_t l  = vldrbq_z_u16(cur   + x - 1, p);
+      uint16x8_t r  = vldrbq_z_u16(cur   + x + 1, p);
+      uint16x8_t u  = vldrbq_z_u16(above + x,     p);
+      uint16x8_t d  = vldrbq_z_u16(below + x,     p);
+      uint16x8_t ul = vldrbq_z_u16(above + x - 1, p);
+      uint16x8_t ur = vldrbq_z_u16(above + x + 1, p);
+      uint16x8_t dl = vldrbq_z_u16(below + x - 1, p);
+      uint16x8_t dr = vldrbq_z_u16(below + x + 1, p);
+
+      uint16x8_t lr    = vaddq_u16(l, r);
+      uint16x8_t ud    = vaddq_u16(u, d);
+      uint16x8_t horz  = vshrq_n_u16(lr, 1);
+      uint16x8_t vert  = vshrq_n_u16(ud, 1);
+      uint16x8_t cross = vshrq_n_u16(vaddq_u16(lr, ud), 2);
+      uint16x8_t diag  = vshrq_n_u16(vaddq_u16(vaddq_u16(ul, ur), vaddq_u16(dl, dr)), 2);
+
+      /* Row colour, green and opposite colour of every lane */
+      uint16x8_t out_own   = vpselq_u16(horz, c,     p_green);
+      uint16x8_t out_g     = vpselq_u16(c,    cross, p_green);
+      uint16x8_t out_other = vpselq_u16(vert, diag,  p_green);
+
+      uint8_t *dst_px = rgb_row + x * 3;
+      vstrbq_scatter_offset_p_u16(dst_px + i_own,   dst_ofs, out_own,   p);
+      vstrbq_scatter_offset_p_u16(dst_px + 1,       dst_ofs, out_g,     p);
+      vstrbq_scatter_offset_p_u16(dst_px + i_other, dst_ofs, out_other, p);
+    }
+
+    debayer_border_px(above, cur, below, width - 1, width - 2, rgb_row,
+                      ((width - 1) & 1) == g_col, i_own, i_other);
+  }
+}
+
+void crop_and_debayer(const uint8_t *src,
+                      int src_width,
+                      int src_height,
+                      int src_crop_x,
+                      int src_crop_y,
+                      uint8_t *dst_rgb,
+                      int dst_width,
+                      int dst_height,
+                      bayer_pattern_t pattern) {
+  crop_and_debayer_mve(src, src_width, src_height, src_crop_x, src_crop_y,
+                       dst_rgb, dst_width, dst_height, pattern, 0, 0x00U, NULL);
+}
+
+void crop_and_debayer_to_input(const uint8_t *src,
+                               int src_width,
+                               int src_height,
+                               int src_crop_x,
+                               int src_crop_y,
+                               void *dst,
+                               int dst_width,
+                               int dst_height,
+                               bayer_pattern_t pattern,
+                               image_format_t dst_format,
+                               int is_signed) {
+  if ((dst_format != IMAGE_FORMAT_RGB888) && (dst_format != IMAGE_FORMAT_GRAYSCALE)) {
+    return; // unsupported format
+  }
+  crop_and_debayer_mve(src, src_width, src_height, src_crop_x, src_crop_y,
+                       (uint8_t *)dst, dst_width, dst_height, pattern,
+                       dst_format == IMAGE_FORMAT_GRAYSCALE,
+                       (is_signed != 0) ? 0x80U : 0x00U, NULL);
+}
+
+void crop_and_debayer_planned(const crop_and_debayer_plan_t *plan,
+                              const uint8_t *src,
+                              void *dst,
+                              bayer_pattern_t pattern,
+                              int is_signed) {
+  crop_and_debayer_mve(src, plan->src_width, plan->src_height, 0, 0,
+                       (uint8_t *)dst, plan->dst_width, plan->dst_height, pattern,
+                       0, (is_signed != 0) ? 0x80U : 0x00U, plan);
+}
+
+void crop_and_debayer_planned_gray(const crop_and_debayer_plan_t *plan,
+                                   const uint8_t *src,
+                                   uint8_t *dst,
+                                   bayer_pattern_t pattern,
+                                   int is_signed) {
+  crop_and_debayer_mve(src, plan->src_width, plan->src_height, 0, 0,
+                       dst, plan->dst_width, plan->dst_height, pattern,
+                       1, (is_signed != 0) ? 0x80U : 0x00U, plan);
+}
+
+void crop_and_debayer_decimate(const uint8_t *src,
+                               int src_width,
+                               int src_height,
+                               int src_crop_x,
+                               int src_crop_y,
+                               uint8_t *dst_rgb,
+                               int dst_width,
+                               int dst_height,
+                               int factor,
+                               bayer_pattern_t pattern) {
+  int shift = (factor == 2) ? 1 :
+              (factor == 4) ? 2 :
+              (factor == 8) ? 3 : 0;
+  if (shift == 0) {
+    return; // unsupported factor
+  }
+  if ((src_crop_x < 0) || (src_crop_y < 0) ||
+      (src_crop_x + dst_width * factor > src_width) ||
+      (src_crop_y + dst_height * factor > src_height)) {
+    return; // crop region outside of the source image
+  }
+
+  const int rb_shift = 2 * shift - 2;
+  const int g_shift  = 2 * shift - 1;
+
+  int offsets[2][2];
+  bayer_offsets(pattern, offsets);
+
+  /* Colour site depends only on the position within a 2x2 quad of the block,
+     so it is the same for all lanes and selects the accumulator directly */
+  int site[2][2];
+  for (int qy = 0; qy < 2; ++qy) {
+    for (int qx = 0; qx < 2; ++qx) {
+      site[qy][qx] = offsets[(src_crop_y + qy) & 1][(src_crop_x + qx) & 1];
+    }
+  }
+
+  /* Offsets of the first sample of consecutive blocks within a row */
+  const uint16x8_t blk_ofs = vmulq_n_u16(vidupq_n_u16(0U, 1), (uint16_t)factor);
+  const uint16x8_t dst_ofs = vmulq_n_u16(vidupq_n_u16(0U, 1), 3U);
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    const uint8_t *blk_row = src + (src_crop_y + dy * factor) * src_width + src_crop_x;
+    uint8_t *dst_row = dst_rgb + dy * dst_width * 3;
+
+    for (int dx = 0; dx < dst_width; dx += MVE_LANES_U16) {
+      int cnt = dst_width - dx;
+      if (cnt > MVE_LANES_U16) {
+        cnt = MVE_LANES_U16;
+      }
+
+      const mve_pred16_t p = vctp16q((uint32_t)cnt);
+      const uint8_t *blk = blk_row + dx * factor;
+
+      /* Per-site sums: 0 = blue, 1 = green, 2 = red (at most 32 samples of 255) */
+      uint16x8_t sum[3] = { vdupq_n_u16(0U), vdupq_n_u16(0U), vdupq_n_u16(0U) };
+
+      for (int j = 0; j < factor; ++j) {
+        const uint8_t *row = blk + j * src_width;
+        const int *s = site[j & 1];
+        for (int i = 0; i < factor; i += 2) {
+          sum[s[0]] = vaddq_u16(sum[s[0]], vldrbq_gather_offset_z_u16(row + i,     blk_ofs, p));
+          sum[s[1]] = vaddq_u16(sum[s[1]], vldrbq_gather_offset_z_u16(row + i + 1, blk_ofs, p));
+        }
+      }
+
+      /* Rounding shift right, identical to (sum + round) >> shift */
+      uint16x8_t out_r = vrshlq_n_u16(sum[2], -rb_shift);
+      uint16x8_t out_g = vrshlq_n_u16(sum[1], -g_shift);
+      uint16x8_t out_b = vrshlq_n_u16(sum[0], -rb_shift);
+
+      uint8_t *dst_px = dst_row + dx * 3;
+      vstrbq_scatter_offset_p_u16(dst_px + 0, dst_ofs, out_r, p);
+      vstrbq_scatter_offset_p_u16(dst_px + 1, dst_ofs, out_g, p);
+      vstrbq_scatter_offset_p_u16(dst_px + 2, dst_ofs, out_b, p);
+    }
+  }
+}
+
+/*
+  Helium sum of absolute differences, sixteen bytes per iteration.
+*/
+uint32_t image_sad(const uint8_t *a, const uint8_t *b, int size) {
+  uint32_t sad = 0;
+
+  for (int32_t n = size; n > 0; n -= 16) {
+    const mve_pred16_t p = vctp8q((uint32_t)n);
+    sad = vabavq_p_u8(sad, vld1q_z_u8(a, p), vld1q_z_u8(b, p), p);
+    a += 16;
+    b += 16;
+  }
+  return sad;
+}
+
+/*
+  Helium uint8 to int8 conversion, sixteen bytes per iteration.
+*/
+void image_to_int8(uint8_t *buf, int size) {
+  const uint8x16_t mask = vdupq_n_u8(0x80U);
+
+  for (int32_t n = size; n > 0; n -= 16) {
+    const mve_pred16_t p = vctp8q((uint32_t)n);
+    vst1q_p_u8(buf, veorq_u8(vld1q_z_u8(buf, p), mask), p);
+    buf += 16;
+  }
+}
+
+/*
+  Helium grayscale to RGB888 expansion, eight pixels per iteration. Each
+  gray vector is scattered to the R, G and B bytes of the pixels, the tail
+  of each row with predication.
+*/
+void image_gray_to_rgb888(const uint8_t *src,
+                          int src_stride,
+                          uint8_t *dst,
+                          int dst_stride,
+                          int width,
+                          int height,
+                          int is_signed) {
+  const uint16x8_t dst_ofs = vmulq_n_u16(vidupq_n_u16(0U, 1), 3U);
+  const uint16x8_t mask = vdupq_n_u16(is_signed ? 0x80U : 0x00U);
+
+  for (int y = 0; y < height; ++y) {
+    const uint8_t *src_px = &src[y * src_stride];
+    uint8_t *dst_px = &dst[y * dst_stride];
+
+    for (int32_t n = width; n > 0; n -= 8) {
+      const mve_pred16_t p = vctp16q((uint32_t)n);
+      const uint16x8_t v = veorq_u16(vldrbq_z_u16(src_px, p), mask);
+
+      vstrbq_scatter_offset_p_u16(dst_px + 0, dst_ofs, v, p);
+      vstrbq_scatter_offset_p_u16(dst_px + 1, dst_ofs, v, p);
+      vstrbq_scatter_offset_p_u16(dst_px + 2, dst_ofs, v, p);
+      src_px += 8;
+      dst_px += 24;
+    }
+  }
+}
+
+/*
+  Helium RGB888 fill: sixteen pixels are stored as three vectors per
+  iteration, the tail of each row with predicated stores.
+*/
+void image_fill_rgb888(uint8_t *dst, int stride, int width, int height, uint32_t color) {
+  if ((width <= 0) || (height <= 0)) {
+    return;
+  }
+
+  /* Sixteen pixels repeat every three vectors */
+  const uint8_t px[3] = { (uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color };
+  uint8_t pattern[48];
+  for (int i = 0; i < 48; ++i) {
+    pattern[i] = px[i % 3];
+  }
+  const uint8x16_t v0 = vld1q_u8(&pattern[0]);
+  const uint8x16_t v1 = vld1q_u8(&pattern[16]);
+  const uint8x16_t v2 = vld1q_u8(&pattern[32]);
+
+  for (int y = 0; y < height; ++y) {
+    uint8_t *row = dst;
+    int32_t bytes = width * 3;
+
+    for (; bytes >= 48; bytes -= 48) {
+      vst1q_u8(row,      v0);
+      vst1q_u8(row + 16, v1);
+      vst1q_u8(row + 32, v2);
+      row += 48;
+    }
+    if (bytes > 0) {
+      vst1q_p_u8(row,      v0, vctp8q((uint32_t)bytes));
+      vst1q_p_u8(row + 16, v1, vctp8q((uint32_t)((bytes > 16) ? (bytes - 16) : 0)));
+      vst1q_p_u8(row + 32, v2, vctp8q((uint32_t)((bytes > 32) ? (bytes - 32) : 0)));
+    }
+    dst += stride;
+  }
+}
+
+#endif /* defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1) */
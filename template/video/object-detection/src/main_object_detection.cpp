@@ -24,11 +24,17 @@
  * the memory requirements for TensorFlow Lite Micro framework and
  * some heap for the API runtime.
  */
+#include <cstring>
+
 #include "BufAttributes.hpp" /* Buffer attributes to be applied */
 #include "Classifier.hpp"    /* Classifier for the result */
 #include "DetectionResult.hpp"
 #include "DetectorPostProcessing.hpp" /* Post Process */
 #include "DetectorPreProcessing.hpp"  /* Pre Process */
+#include "FrameGovernor.hpp"
+#include "HeapMonitor.hpp"
+#include "ObjectTracker.hpp"
+#include "StageProfiler.hpp"
 #include "VideoSource.hpp"
 #include "YoloFastestModel.hpp"       /* Model API */
 
@@ -43,12 +49,599 @@ using namespace arm::app;
 /* Tensor arena buffer */
 static uint8_t tensorArena[ACTIVATION_BUF_SZ] ACTIVATION_BUF_ATTRIBUTE;
 
+/* Detection results reserved up front, so the image loop does not grow the result vectors */
+#define MAX_DETECTION_RESULTS   32U
+
 /* Optional getter function for the model pointer and its size. */
 namespace arm::app::object_detection {
     extern uint8_t* GetModelPointer();
     extern size_t GetModelLen();
 }
 
+/**
+ * @brief   Reports the images found unchanged by the change gate of the image
+ *          source, if more images were skipped since the last report.
+ *
+ * @param[in,out]   reported    Number of skipped images already reported.
+ */
+static void report_skipped_images(uint32_t& reported)
+{
+    uint32_t processed;
+    uint32_t skipped;
+
+    get_img_gate_counts(&processed, &skipped);
+    if (skipped != reported) {
+        reported = skipped;
+        printf("Skipped inference: %" PRIu32 " unchanged images, %" PRIu32 " images inferred\n", skipped, processed);
+    }
+}
+
+/**
+ * @brief   Decides whether the detector runs on the current image.
+ *
+ * Unchanged images are not passed to the detector. With the tracker enabled
+ * the detector runs on every APP_TRACKER_DETECT_INTERVAL-th changed image.
+ *
+ * @param[in]       changed     Image differs from the last inferred image.
+ * @param[in,out]   count       Changed images since the detector last ran.
+ * @return          true if the detector runs on the image.
+ */
+static bool detect_image(const bool changed, uint32_t& count)
+{
+    if (!changed) {
+        return false;
+    }
+#if (APP_TRACKER != 0)
+    const bool detect = (count == 0);
+    count = (count + 1) % APP_TRACKER_DETECT_INTERVAL;
+    return detect;
+#else
+    (void)count;
+    return true;
+#endif
+}
+
+#if (ROI_REINFER != 0) && (APP_PIPELINE == 0)
+/* Minimum IoU of a region detection with a known detection to replace it */
+#define ROI_MERGE_IOU   0.3f
+
+/**
+ * @brief   Computes the intersection over union of two detection boxes.
+ */
+static float detection_iou(const object_detection::DetectionResult& a,
+                           const object_detection::DetectionResult& b)
+{
+    const float ax1 = static_cast<float>(a.m_x0 + a.m_w);
+    const float ay1 = static_cast<float>(a.m_y0 + a.m_h);
+    const float bx1 = static_cast<float>(b.m_x0 + b.m_w);
+    const float by1 = static_cast<float>(b.m_y0 + b.m_h);
+    const float ix  = ((ax1 < bx1) ? ax1 : bx1) - static_cast<float>((a.m_x0 > b.m_x0) ? a.m_x0 : b.m_x0);
+    const float iy  = ((ay1 < by1) ? ay1 : by1) - static_cast<float>((a.m_y0 > b.m_y0) ? a.m_y0 : b.m_y0);
+
+    if ((ix <= 0.0f) || (iy <= 0.0f)) {
+        return 0.0f;
+    }
+
+    const float inter = ix * iy;
+    const float uni   = static_cast<float>(a.m_w * a.m_h + b.m_w * b.m_h) - inter;
+    return (uni > 0.0f) ? (inter / uni) : 0.0f;
+}
+
+/**
+ * @brief   Maps a detection of a region of interest to the ML image and merges
+ *          it into the detections of the image. It replaces the best matching
+ *          detection, which it refines, or is added as a new detection.
+ *
+ * @param[in]       det         Detection in region of interest coordinates.
+ * @param[in]       roi         Region of interest.
+ * @param[in,out]   results     Detections of the image.
+ */
+static void merge_roi_result(const object_detection::DetectionResult& det,
+                             const img_roi_t& roi,
+                             std::vector<object_detection::DetectionResult>& results)
+{
+    float x0 = roi.x0 + roi.scale * static_cast<float>(det.m_x0);
+    float y0 = roi.y0 + roi.scale * static_cast<float>(det.m_y0);
+    float x1 = x0 + roi.scale * static_cast<float>(det.m_w);
+    float y1 = y0 + roi.scale * static_cast<float>(det.m_h);
+
+    /* Region may extend beyond the ML image, keep the visible part */
+    x0 = (x0 < 0.0f) ? 0.0f : x0;
+    y0 = (y0 < 0.0f) ? 0.0f : y0;
+    x1 = (x1 > ML_IMAGE_WIDTH)  ? ML_IMAGE_WIDTH  : x1;
+    y1 = (y1 > ML_IMAGE_HEIGHT) ? ML_IMAGE_HEIGHT : y1;
+    if ((x1 - x0 < 1.0f) || (y1 - y0 < 1.0f)) {
+        return;
+    }
+
+    object_detection::DetectionResult mapped = det;
+    mapped.m_x0 = static_cast<uint32_t>(x0 + 0.5f);
+    mapped.m_y0 = static_cast<uint32_t>(y0 + 0.5f);
+    mapped.m_w  = static_cast<uint32_t>(x1 - x0 + 0.5f);
+    mapped.m_h  = static_cast<uint32_t>(y1 - y0 + 0.5f);
+
+    float  bestIou = 0.0f;
+    size_t best    = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        const float iou = detection_iou(mapped, results[i]);
+        if (iou > bestIou) {
+            bestIou = iou;
+            best    = i;
+        }
+    }
+
+    if (bestIou >= ROI_MERGE_IOU) {
+        results[best] = mapped;
+    } else {
+        results.push_back(mapped);
+    }
+}
+
+/**
+ * @brief   Runs the model again on the neighbourhood of the detections of the
+ *          image, cropped from the source frame at a higher resolution, and
+ *          merges the detections found in the crops. At most ROI_REINFER_MAX
+ *          regions are inferred, detections too large to gain detail are skipped.
+ *
+ * @param[in]       img_idx         Image index.
+ * @param[in]       model           Model.
+ * @param[in]       postProcess     Post-processing writing to roiResults.
+ * @param[in,out]   roiResults      Detections of a region of interest.
+ * @param[in,out]   results         Detections of the image.
+ * @return          true on success, false if inference failed.
+ */
+static bool reinfer_regions(const uint32_t img_idx,
+                            YoloFastestModel& model,
+                            DetectorPostProcess& postProcess,
+                            std::vector<object_detection::DetectionResult>& roiResults,
+                            std::vector<object_detection::DetectionResult>& results)
+{
+    const size_t count   = results.size();
+    uint32_t     regions = 0;
+
+    for (size_t i = 0; (i < count) && (regions < ROI_REINFER_MAX); i++) {
+        const object_detection::DetectionResult det = results[i];
+        img_roi_t roi;
+
+        /* Region is written into the model input tensor */
+        if (!read_img_roi(img_idx, det.m_x0, det.m_y0, det.m_w, det.m_h, &roi)) {
+            continue;
+        }
+        regions++;
+
+        roiResults.clear();
+        if (!model.RunInference()) {
+            printf_err("Inference failed.\n");
+            return false;
+        }
+        if (!postProcess.DoPostProcess()) {
+            printf_err("Post-processing failed.\n");
+            return false;
+        }
+
+        for (const auto& roiResult : roiResults) {
+            merge_roi_result(roiResult, roi, results);
+        }
+    }
+    return true;
+}
+#endif
+
+#if (APP_TRACKER == 0)
+/**
+ * @brief   Sends detection results to the console and sets their boxes to the image.
+ *
+ * @param[in]   img_idx     Image index.
+ * @param[in]   results     Detection results.
+ * @param[in]   display     true if boxes are set to the displayed image.
+ */
+static void report_results(const uint32_t img_idx,
+                           const std::vector<object_detection::DetectionResult>& results,
+                           const bool display)
+{
+    if (results.empty()) {
+        printf("No object detected\n");
+        return;
+    }
+
+    printf("Detected objects ");
+    for (const auto& result : results) {
+        /* Set object detection box to the image */
+        if (display) {
+            set_img_object_box(img_idx, result.m_x0, result.m_y0, result.m_w, result.m_h);
+        }
+
+        /* Sent detection coordinates to the console */
+        printf(":: [x=%" PRIu32 ", y=%" PRIu32 ", w=%" PRIu32 ", h=%" PRIu32 "] ", result.m_x0,
+                                                                                   result.m_y0,
+                                                                                   result.m_w,
+                                                                                   result.m_h);
+    }
+    printf("\n");
+}
+
+#else
+/**
+ * @brief   Sends tracked objects to the console and sets their boxes to the image.
+ *
+ * @param[in]   img_idx     Image index.
+ * @param[in]   tracker     Object tracker.
+ * @param[in]   display     true if boxes are set to the displayed image.
+ */
+static void report_tracks(const uint32_t img_idx, const ObjectTracker& tracker, const bool display)
+{
+    if (tracker.GetCount() == 0) {
+        printf("No object tracked\n");
+        return;
+    }
+
+    printf("Tracked objects ");
+    for (size_t i = 0; i < tracker.GetCount(); i++) {
+        uint32_t x0, y0, w, h;
+        tracker.GetBox(i, x0, y0, w, h);
+
+        /* Set object box to the image */
+        if (display) {
+            set_img_object_box(img_idx, x0, y0, w, h);
+        }
+
+        /* Sent track identifier and coordinates to the console */
+        printf(":: [id=%" PRIu32 ", x=%" PRIu32 ", y=%" PRIu32 ", w=%" PRIu32 ", h=%" PRIu32 "] ",
+               tracker.GetTrack(i).id, x0, y0, w, h);
+    }
+    printf("\n");
+}
+#endif
+
+#if (APP_PIPELINE != 0)
+/* Pipeline stages */
+enum PipelineStage {
+    STAGE_CAPTURE = 0,  /* Capture and convert image */
+    STAGE_INFER,        /* Pre-processing and inference */
+    STAGE_PRESENT,      /* Post-processing, boxes and display */
+    STAGE_COUNT
+};
+
+/* Slot index marking the end of the image stream */
+#define PIPELINE_SLOT_END   0xFFU
+
+/* Thread flag set by the present stage when it has finished */
+#define PIPELINE_FLAG_DONE  0x100U
+
+/* Frame slot handed over between the pipeline stages */
+struct PipelineSlot {
+    uint32_t imgIdx;                /* Image index */
+    uint32_t dropped;               /* Images dropped by the image source so far */
+    bool     changed;               /* Image differs from the last inferred image */
+    bool     detect;                /* Detector runs on the image */
+    uint32_t time[STAGE_COUNT];     /* Time spent in each stage (kernel system timer ticks) */
+    alignas(16) uint8_t output[APP_PIPELINE_OUTPUT_BUF_SZ]; /* Copy of the model output tensors */
+};
+
+/* State shared by the pipeline stages */
+struct PipelineContext {
+    osMessageQueueId_t freeQueue;       /* Slots available for capture */
+    osMessageQueueId_t inferQueue;      /* Captured slots waiting for inference */
+    osMessageQueueId_t presentQueue;    /* Inferred slots waiting for display */
+    osThreadId_t       inferThread;     /* Thread running the inference stage */
+    TfLiteTensor*      outputTensor0;   /* Model output tensors */
+    TfLiteTensor*      outputTensor1;
+    size_t             output1Offset;   /* Offset of output tensor 1 in the slot output copy */
+    object_detection::PostProcessParams postProcessParams;
+    volatile bool      stop;            /* Set when a stage fails, the stages then return
+                                           their slots unprocessed until the end of stream */
+};
+
+/* ML images of the frame slots (RGB888) */
+static uint8_t pipelineImage[APP_PIPELINE_SLOTS][ML_IMAGE_SIZE] ML_IMAGE_BUF_ATTRIBUTE;
+
+/* Frame slots */
+static PipelineSlot pipelineSlot[APP_PIPELINE_SLOTS];
+
+/**
+ * @brief   Capture stage: reads images from the image source into free slots.
+ *
+ * Waiting for a free slot throttles the capture to the slowest stage. The
+ * end of stream marker is sent when the image source ends or the pipeline
+ * stops.
+ *
+ * @param[in]   arg     Pointer to the pipeline context.
+ */
+static void pipeline_capture_thread(void *arg)
+{
+    PipelineContext* ctx = static_cast<PipelineContext*>(arg);
+    uint32_t img_idx = 0;
+    uint32_t detect_count = 0;
+    uint8_t slot;
+
+    while (!ctx->stop) {
+        if (osMessageQueueGet(ctx->freeQueue, &slot, nullptr, osWaitForever) != osOK) {
+            break;
+        }
+
+        const uint32_t start = osKernelGetSysTimerCount();
+
+        if (ctx->stop || !read_img_source(img_idx, pipelineImage[slot], ML_IMAGE_SIZE)) {
+            osMessageQueuePut(ctx->freeQueue, &slot, 0U, osWaitForever);
+            break;
+        }
+
+        pipelineSlot[slot].imgIdx  = img_idx++;
+        pipelineSlot[slot].dropped = get_img_dropped_count();
+        pipelineSlot[slot].changed = get_img_changed(pipelineSlot[slot].imgIdx);
+        pipelineSlot[slot].detect  = detect_image(pipelineSlot[slot].changed, detect_count);
+        if (pipelineSlot[slot].detect) {
+            /* Only an inferred image becomes the reference of the change gate */
+            set_img_inferred(pipelineSlot[slot].imgIdx);
+        }
+        pipelineSlot[slot].time[STAGE_CAPTURE] = osKernelGetSysTimerCount() - start;
+
+        osMessageQueuePut(ctx->inferQueue, &slot, 0U, osWaitForever);
+    }
+
+    /* Signal end of the image stream */
+    slot = PIPELINE_SLOT_END;
+    osMessageQueuePut(ctx->inferQueue, &slot, 0U, osWaitForever);
+}
+
+/**
+ * @brief   Present stage: post-processes the model output copy of a slot,
+ *          reports and displays the detected objects and frees the slot.
+ *
+ * Runs until the end of stream marker, once the pipeline is stopped the
+ * slots are freed without being presented.
+ *
+ * @param[in]   arg     Pointer to the pipeline context.
+ */
+static void pipeline_present_thread(void *arg)
+{
+    PipelineContext* ctx = static_cast<PipelineContext*>(arg);
+
+    /* Object to hold detection results */
+    std::vector<object_detection::DetectionResult> results;
+    results.reserve(MAX_DETECTION_RESULTS);
+
+#if (APP_TRACKER != 0)
+    ObjectTracker tracker(ctx->postProcessParams.inputImgCols, ctx->postProcessParams.inputImgRows);
+#endif
+
+    /* Post-processing reads the output copy in the slot, the model may already run the next image */
+    TfLiteTensor outputTensor0[APP_PIPELINE_SLOTS];
+    TfLiteTensor outputTensor1[APP_PIPELINE_SLOTS];
+    std::vector<DetectorPostProcess> postProcess;
+
+    postProcess.reserve(APP_PIPELINE_SLOTS);
+    for (uint32_t i = 0; i < APP_PIPELINE_SLOTS; i++) {
+        outputTensor0[i] = *ctx->outputTensor0;
+        outputTensor0[i].data.data = pipelineSlot[i].output;
+        outputTensor1[i] = *ctx->outputTensor1;
+        outputTensor1[i].data.data = pipelineSlot[i].output + ctx->output1Offset;
+        postProcess.emplace_back(&outputTensor0[i], &outputTensor1[i], results, ctx->postProcessParams);
+    }
+
+    uint32_t dropped = 0;
+    uint32_t skipped = 0;
+    uint32_t statImages = 0;
+    uint64_t statTime[STAGE_COUNT] = {};
+    uint64_t statElapsed = 0;
+    uint32_t statLast = osKernelGetSysTimerCount();
+    uint8_t slot;
+
+    /* Pipeline is set up, the stages run without allocating from now on */
+    heap_monitor_start();
+
+    while (osMessageQueueGet(ctx->presentQueue, &slot, nullptr, osWaitForever) == osOK) {
+        if (slot == PIPELINE_SLOT_END) {
+            break;
+        }
+
+        const uint32_t start = osKernelGetSysTimerCount();
+        const uint32_t img_idx = pipelineSlot[slot].imgIdx;
+
+        /* Results of the last inference are kept while the scene is static */
+        if (!ctx->stop && pipelineSlot[slot].detect) {
+            results.clear();
+
+            if (!postProcess[slot].DoPostProcess()) {
+                printf_err("Post-processing failed.\n");
+                ctx->stop = true;
+            }
+        }
+
+        if (ctx->stop) {
+            /* Free the slot, so the capture stage can finish the stream */
+            osMessageQueuePut(ctx->freeQueue, &slot, 0U, osWaitForever);
+            continue;
+        }
+
+#if (APP_TRACKER != 0)
+        if (pipelineSlot[slot].detect) {
+            tracker.Update(results);
+        } else if (pipelineSlot[slot].changed) {
+            tracker.Predict();
+        }
+#endif
+
+        /* Report images skipped by the image source since the previous image */
+        if (pipelineSlot[slot].dropped != dropped) {
+            dropped = pipelineSlot[slot].dropped;
+            printf("Dropped images: %" PRIu32 "\n", dropped);
+        }
+
+        /* Report images without inference when the scene changes again */
+        if (pipelineSlot[slot].changed) {
+            report_skipped_images(skipped);
+        }
+
+        printf("Image %" PRIu32 ": ", img_idx);
+        if (!pipelineSlot[slot].changed) {
+            printf("No change, ");
+        }
+
+        const bool display = open_img_display(img_idx, pipelineImage[slot]);
+
+#if (APP_TRACKER != 0)
+        report_tracks(img_idx, tracker, display);
+#else
+        report_results(img_idx, results, display);
+#endif
+
+        if (display) {
+            close_img_source(img_idx);
+        }
+
+        const uint32_t now = osKernelGetSysTimerCount();
+        pipelineSlot[slot].time[STAGE_PRESENT] = now - start;
+
+        /* Accumulate stage timing and report it periodically */
+        for (uint32_t i = 0; i < STAGE_COUNT; i++) {
+            statTime[i] += pipelineSlot[slot].time[i];
+        }
+        statElapsed += now - statLast;
+        statLast = now;
+
+        if ((APP_PIPELINE_STATS_INTERVAL != 0) && (++statImages == APP_PIPELINE_STATS_INTERVAL)) {
+            const uint64_t freq = osKernelGetSysTimerFreq();
+            const uint64_t fps  = (statElapsed != 0U) ? ((statImages * freq * 100U) / statElapsed) : 0U;
+
+            printf("Pipeline: %" PRIu32 ".%02" PRIu32 " images/s, capture %" PRIu32 " us, inference %" PRIu32
+                   " us, present %" PRIu32 " us\n",
+                   static_cast<uint32_t>(fps / 100U),
+                   static_cast<uint32_t>(fps % 100U),
+                   static_cast<uint32_t>((statTime[STAGE_CAPTURE] * 1000000U) / (freq * statImages)),
+                   static_cast<uint32_t>((statTime[STAGE_INFER]   * 1000000U) / (freq * statImages)),
+                   static_cast<uint32_t>((statTime[STAGE_PRESENT] * 1000000U) / (freq * statImages)));
+
+            statImages = 0;
+            statElapsed = 0;
+            for (uint32_t i = 0; i < STAGE_COUNT; i++) {
+                statTime[i] = 0;
+            }
+        }
+
+        heap_monitor_check("image pipeline");
+
+        /* Slot can be reused for capture */
+        osMessageQueuePut(ctx->freeQueue, &slot, 0U, osWaitForever);
+    }
+
+    osThreadFlagsSet(ctx->inferThread, PIPELINE_FLAG_DONE);
+}
+
+/**
+ * @brief   Runs the pipelined object detection.
+ *
+ * Capture and present stages run in their own threads, the inference stage
+ * runs in the calling thread. The stages hand over frame slot indices through
+ * message queues, so the capture of the next image and the display of the
+ * previous image overlap the inference.
+ *
+ * When a stage fails it sets the stop flag. Every stage then frees the slots
+ * it receives without processing them, so the capture stage always gets a
+ * slot back, sees the flag and sends the end of stream marker through the
+ * pipeline.
+ *
+ * @param[in]   model               Initialised model.
+ * @param[in]   preProcess          Pre-processing of the model input.
+ * @param[in]   outputTensor0       Model output tensor 0.
+ * @param[in]   outputTensor1       Model output tensor 1.
+ * @param[in]   postProcessParams   Post-processing parameters.
+ */
+static void run_pipeline(YoloFastestModel& model, DetectorPreProcess& preProcess,
+                         TfLiteTensor* outputTensor0, TfLiteTensor* outputTensor1,
+                         const object_detection::PostProcessParams& postProcessParams)
+{
+    static PipelineContext ctx{};
+
+    ctx.outputTensor0     = outputTensor0;
+    ctx.outputTensor1     = outputTensor1;
+    ctx.output1Offset     = (ctx.outputTensor0->bytes + 15U) & ~static_cast<size_t>(15U);
+    ctx.postProcessParams = postProcessParams;
+    ctx.inferThread       = osThreadGetId();
+    ctx.stop              = false;
+
+    if ((ctx.output1Offset + ctx.outputTensor1->bytes) > APP_PIPELINE_OUTPUT_BUF_SZ) {
+        printf_err("Pipeline output buffer too small, %zu bytes required\n",
+                   ctx.output1Offset + ctx.outputTensor1->bytes);
+        return;
+    }
+
+    /* Queues hold every slot and the end of stream marker, so only the free queue blocks */
+    ctx.freeQueue    = osMessageQueueNew(APP_PIPELINE_SLOTS + 1U, sizeof(uint8_t), nullptr);
+    ctx.inferQueue   = osMessageQueueNew(APP_PIPELINE_SLOTS + 1U, sizeof(uint8_t), nullptr);
+    ctx.presentQueue = osMessageQueueNew(APP_PIPELINE_SLOTS + 1U, sizeof(uint8_t), nullptr);
+    if ((ctx.freeQueue == nullptr) || (ctx.inferQueue == nullptr) || (ctx.presentQueue == nullptr)) {
+        printf_err("Failed to create pipeline queues\n");
+        return;
+    }
+
+    for (uint8_t slot = 0; slot < APP_PIPELINE_SLOTS; slot++) {
+        osMessageQueuePut(ctx.freeQueue, &slot, 0U, 0U);
+    }
+
+    const osThreadAttr_t attr = {
+        .stack_size = 4096U
+    };
+
+    if ((osThreadNew(pipeline_present_thread, &ctx, &attr) == nullptr) ||
+        (osThreadNew(pipeline_capture_thread, &ctx, &attr) == nullptr)) {
+        printf_err("Failed to create pipeline threads\n");
+        return;
+    }
+
+    uint8_t slot;
+
+    while (osMessageQueueGet(ctx.inferQueue, &slot, nullptr, osWaitForever) == osOK) {
+        if (slot == PIPELINE_SLOT_END) {
+            break;
+        }
+
+        if (ctx.stop) {
+            /* Free the slot, so the capture stage can finish the stream */
+            osMessageQueuePut(ctx.freeQueue, &slot, 0U, osWaitForever);
+            continue;
+        }
+
+        const uint32_t start = osKernelGetSysTimerCount();
+
+        if (!pipelineSlot[slot].detect) {
+            /* Static scene or tracked image, the present stage reuses the previous results */
+            pipelineSlot[slot].time[STAGE_INFER] = 0U;
+            osMessageQueuePut(ctx.presentQueue, &slot, 0U, osWaitForever);
+            continue;
+        }
+
+        /* Run the pre-processing and inference. */
+        if (!preProcess.DoPreProcess(pipelineImage[slot], ML_IMAGE_SIZE)) {
+            printf_err("Pre-processing failed.\n");
+            ctx.stop = true;
+            osMessageQueuePut(ctx.freeQueue, &slot, 0U, osWaitForever);
+            continue;
+        }
+
+        if (!model.RunInference()) {
+            printf_err("Inference failed.\n");
+            ctx.stop = true;
+            osMessageQueuePut(ctx.freeQueue, &slot, 0U, osWaitForever);
+            continue;
+        }
+
+        /* Model output is overwritten by the next inference, keep a copy for post-processing */
+        memcpy(pipelineSlot[slot].output, ctx.outputTensor0->data.data, ctx.outputTensor0->bytes);
+        memcpy(pipelineSlot[slot].output + ctx.output1Offset, ctx.outputTensor1->data.data, ctx.outputTensor1->bytes);
+
+        pipelineSlot[slot].time[STAGE_INFER] = osKernelGetSysTimerCount() - start;
+
+        osMessageQueuePut(ctx.presentQueue, &slot, 0U, osWaitForever);
+    }
+
+    /* Signal end of the image stream and wait until all images are presented */
+    slot = PIPELINE_SLOT_END;
+    osMessageQueuePut(ctx.presentQueue, &slot, 0U, osWaitForever);
+    osThreadFlagsWait(PIPELINE_FLAG_DONE, osFlagsWaitAny, osWaitForever);
+}
+#endif
+
 void app_main_thread(void *arg)
 {
     /* Model object creation and initialisation. */
@@ -75,9 +668,6 @@ void app_main_thread(void *arg)
     const int inputImgCols = inputShape->data[YoloFastestModel::ms_inputColsIdx];
     const int inputImgRows = inputShape->data[YoloFastestModel::ms_inputRowsIdx];
 
-    /* Object to hold detection results */
-    std::vector<object_detection::DetectionResult> results;
-
     /* Set up pre and post-processing. */
     DetectorPreProcess preProcess = DetectorPreProcess(inputTensor, true, model.IsDataSigned());
 
@@ -88,57 +678,138 @@ void app_main_thread(void *arg)
         object_detection::anchor1,
         object_detection::anchor2};
 
+#if (APP_PIPELINE != 0)
+    /* Model input is shared, images are always pre-processed from the frame slots */
+    run_pipeline(model, preProcess, outputTensor0, outputTensor1, postProcessParams);
+#else
+    /* Object to hold detection results */
+    std::vector<object_detection::DetectionResult> results;
+    results.reserve(MAX_DETECTION_RESULTS);
+
+#if (APP_TRACKER != 0)
+    ObjectTracker tracker(inputImgCols, inputImgRows);
+#endif
+
     DetectorPostProcess postProcess = DetectorPostProcess(outputTensor0, outputTensor1, results, postProcessParams);
 
+#if (ROI_REINFER != 0)
+    /* Detections of a region of interest are merged into the image results */
+    std::vector<object_detection::DetectionResult> roiResults;
+    roiResults.reserve(MAX_DETECTION_RESULTS);
+    DetectorPostProcess roiPostProcess = DetectorPostProcess(outputTensor0, outputTensor1, roiResults, postProcessParams);
+#endif
+
+    /* Let the image source write directly into the model input tensor when supported */
+    const int inputImgChannels = inputShape->data[YoloFastestModel::ms_inputChannelsIdx];
+    const img_layout_t inputLayout = (inputImgChannels == 1) ? IMG_LAYOUT_GRAYSCALE : IMG_LAYOUT_RGB888;
+    const bool directInput = set_img_input_buffer(inputTensor->data.data, inputTensor->bytes,
+                                                  inputLayout, model.IsDataSigned());
+
     uint32_t img_idx = 0;
     size_t img_sz;
     const uint8_t *img_buf;
+    uint32_t dropped = 0;
+    uint32_t skipped = 0;
+    uint32_t detect_count = 0;
 
-    while (open_img_source(img_idx)) {
-        results.clear();
+    /* Stage timing, measurement compiles to nothing unless APP_PROFILE is enabled */
+    StageProfiler profiler;
 
-        img_buf = get_img_array(img_idx);
-        img_sz  = get_img_array_size(img_idx);
+    /* Frame rate and quality control, every image is processed unless FRAME_GOVERNOR is enabled */
+    FrameGovernor governor;
 
-        /* Run the pre-processing, inference and post-processing. */
-        if (!preProcess.DoPreProcess(img_buf, img_sz)) {
-            printf_err("Pre-processing failed.\n");
-            return;
+    /* Initialisation is complete, the image loop runs without allocating from now on */
+    heap_monitor_start();
+
+    governor.Start();
+    profiler.Start(PROFILE_PREPARE_FRAME);
+    while (open_img_source(img_idx)) {
+        /* Results of the last inference are kept while the scene is static or the governor skips the image */
+        const bool changed = get_img_changed(img_idx);
+        const bool detect  = detect_image(changed, detect_count) && governor.InferImage();
+        if (detect) {
+            /* Only an inferred image becomes the reference of the change gate */
+            set_img_inferred(img_idx);
         }
+        profiler.Stop(PROFILE_PREPARE_FRAME);
 
-        printf("Image %" PRIu32 ": ", img_idx);
+        if (detect && !directInput) {
+            img_buf = get_img_array(img_idx);
+            img_sz  = get_img_array_size(img_idx);
 
-        /* Run inference over this image. */
-        if (!model.RunInference()) {
-            printf_err("Inference failed.\n");
-            return;
+            /* Run the pre-processing, inference and post-processing. */
+            profiler.Start(PROFILE_PRE_PROCESSING);
+            if (!preProcess.DoPreProcess(img_buf, img_sz)) {
+                printf_err("Pre-processing failed.\n");
+                return;
+            }
+            profiler.Stop(PROFILE_PRE_PROCESSING);
         }
 
-        if (!postProcess.DoPostProcess()) {
-            printf_err("Post-processing failed.\n");
-            return;
+        /* Report frames skipped by the image source since the previous image */
+        if (get_img_dropped_count() != dropped) {
+            dropped = get_img_dropped_count();
+            printf("Dropped images: %" PRIu32 "\n", dropped);
         }
 
-        if (results.empty()) {
-            printf("No object detected\n");
+        /* Report images without inference when the scene changes again */
+        if (changed) {
+            report_skipped_images(skipped);
         }
-        else {
-            printf("Detected objects ");
-            for (const auto& result : results) {
-                /* Set object detection box to the image */
-                set_img_object_box(img_idx, result.m_x0, result.m_y0, result.m_w, result.m_h);
 
-                /* Sent detection coordinates to the console */
-                printf(":: [x=%" PRIu32 ", y=%" PRIu32 ", w=%" PRIu32 ", h=%" PRIu32 "] ", result.m_x0,
-                                                                                           result.m_y0,
-                                                                                           result.m_w,
-                                                                                           result.m_h);
+        printf("Image %" PRIu32 ": ", img_idx);
+
+        if (detect) {
+            results.clear();
+
+            /* Run inference over this image. */
+            profiler.Start(PROFILE_INFERENCE);
+            if (!model.RunInference()) {
+                printf_err("Inference failed.\n");
+                return;
+            }
+            profiler.Stop(PROFILE_INFERENCE);
+
+            profiler.Start(PROFILE_POST_PROCESSING);
+            if (!postProcess.DoPostProcess()) {
+                printf_err("Post-processing failed.\n");
+                return;
             }
-            printf("\n");
+
+#if (ROI_REINFER != 0)
+            /* Refine small detections at the resolution of the source frame */
+            if (directInput && !reinfer_regions(img_idx, model, roiPostProcess, roiResults, results)) {
+                return;
+            }
+#endif
+            profiler.Stop(PROFILE_POST_PROCESSING);
+        }
+        else if (!changed) {
+            printf("No change, ");
         }
 
+#if (APP_TRACKER != 0)
+        if (detect) {
+            tracker.Update(results);
+        } else if (changed) {
+            tracker.Predict();
+        }
+        report_tracks(img_idx, tracker, true);
+#else
+        report_results(img_idx, results, true);
+#endif
+
+        profiler.Start(PROFILE_DISPLAY);
         close_img_source(img_idx++);
+        profiler.Stop(PROFILE_DISPLAY);
+
+        heap_monitor_check("image loop");
+
+        profiler.EndImage();
+        governor.NextImage();
+        profiler.Start(PROFILE_PREPARE_FRAME);
     }
+#endif
 }
 
 /* Application initialization */
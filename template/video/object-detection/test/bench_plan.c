@@ -0,0 +1,153 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Host benchmark of the precomputed sampling plans.
+
+  Times the live video geometry with and without a plan, using the scalar
+  implementations:
+  - 1280x720 RAW8 camera frame, center crop, debayered to 384x384 RGB888
+  - 384x384 RGB888 image resized to the 192x192 model input (RGB888 and
+    grayscale)
+  The planned output is checked bit-exact against the unplanned output.
+
+  Usage: bench_plan [iterations]
+*/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+
+#include "image_processing_func.h"
+#include "test_common.h"
+
+#define CAMERA_WIDTH    1280
+#define CAMERA_HEIGHT   720
+#define RGB_WIDTH       384
+#define RGB_HEIGHT      384
+#define ML_WIDTH        192
+#define ML_HEIGHT       192
+
+/* Timed operation */
+typedef void (*bench_func_t)(void *arg);
+
+/*
+  Get monotonic time in microseconds.
+*/
+static double time_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec * 1e-3;
+}
+
+/*
+  Run an operation repeatedly and get its fastest run.
+
+  \param[in] func        Operation.
+  \param[in] arg         Argument of the operation.
+  \param[in] iterations  Number of timed runs.
+  \return                Fastest run in microseconds.
+*/
+static double bench(bench_func_t func, void *arg, int iterations) {
+  double best = 1e30;
+
+  func(arg);  /* Warm up caches */
+  for (int i = 0; i < iterations; ++i) {
+    const double start = time_us();
+    func(arg);
+    const double t = time_us() - start;
+    if (t < best) {
+      best = t;
+    }
+  }
+  return best;
+}
+
+/* Buffers and plans shared by the timed operations */
+static uint8_t  raw[CAMERA_WIDTH * CAMERA_HEIGHT];
+static uint8_t  rgb[RGB_WIDTH * RGB_HEIGHT * 3];
+static uint8_t  rgb_planned[RGB_WIDTH * RGB_HEIGHT * 3];
+static uint8_t  ml[ML_WIDTH * ML_HEIGHT * 3];
+static uint8_t  ml_planned[ML_WIDTH * ML_HEIGHT * 3];
+static uint16_t debayer_plan_buf[CROP_AND_DEBAYER_PLAN_BUF_SIZE(RGB_WIDTH, RGB_HEIGHT)];
+static uint16_t resize_plan_buf[IMAGE_RESIZE_PLAN_BUF_SIZE(ML_WIDTH, ML_HEIGHT)];
+static crop_and_debayer_plan_t debayer_plan;
+static image_resize_plan_t     resize_plan;
+static image_format_t          ml_format;
+
+static void run_crop_and_debayer(void *arg) {
+  (void)arg;
+  crop_and_debayer(raw, CAMERA_WIDTH, CAMERA_HEIGHT,
+                   (CAMERA_WIDTH - RGB_WIDTH) / 2, (CAMERA_HEIGHT - RGB_HEIGHT) / 2,
+                   rgb, RGB_WIDTH, RGB_HEIGHT, BAYER_PATTERN_GBRG);
+}
+
+static void run_crop_and_debayer_planned(void *arg) {
+  (void)arg;
+  crop_and_debayer_planned(&debayer_plan, raw, rgb_planned, BAYER_PATTERN_GBRG, 0);
+}
+
+static void run_image_resize(void *arg) {
+  (void)arg;
+  image_resize(rgb, RGB_WIDTH, RGB_HEIGHT, ml, ML_WIDTH, ML_HEIGHT, IMAGE_FORMAT_RGB888, ml_format);
+}
+
+static void run_image_resize_planned(void *arg) {
+  (void)arg;
+  image_resize_planned(&resize_plan, rgb, ml_planned, IMAGE_FORMAT_RGB888, ml_format);
+}
+
+/*
+  Time an operation with and without a plan and check their outputs.
+*/
+static void compare(const char *name, bench_func_t func, bench_func_t func_planned,
+                    const uint8_t *out, const uint8_t *out_planned, int size, int iterations) {
+  const double t      = bench(func, NULL, iterations);
+  const double t_plan = bench(func_planned, NULL, iterations);
+
+  printf("%-34s %9.1f us %9.1f us %6.2fx\n", name, t, t_plan, t / t_plan);
+  test_check_equal(name, out, out_planned, size);
+}
+
+int main(int argc, char *argv[]) {
+  const int iterations = (argc > 1) ? atoi(argv[1]) : 200;
+  uint32_t seed = 0x13579BDFU;
+
+  test_fill_random(raw, sizeof(raw), &seed);
+
+  crop_and_debayer_plan_init(&debayer_plan, debayer_plan_buf, CAMERA_WIDTH, CAMERA_HEIGHT,
+                             (CAMERA_WIDTH - RGB_WIDTH) / 2, (CAMERA_HEIGHT - RGB_HEIGHT) / 2,
+                             RGB_WIDTH, RGB_HEIGHT);
+  image_resize_plan_init(&resize_plan, resize_plan_buf, RGB_WIDTH, RGB_HEIGHT, ML_WIDTH, ML_HEIGHT);
+
+  printf("%-34s %12s %12s %7s\n", "Operation (per frame)", "unplanned", "planned", "gain");
+
+  compare("1280x720 -> 384x384 debayer", run_crop_and_debayer, run_crop_and_debayer_planned,
+          rgb, rgb_planned, sizeof(rgb), iterations);
+
+  ml_format = IMAGE_FORMAT_RGB888;
+  compare("384x384 -> 192x192 resize RGB888", run_image_resize, run_image_resize_planned,
+          ml, ml_planned, ML_WIDTH * ML_HEIGHT * 3, iterations);
+
+  ml_format = IMAGE_FORMAT_GRAYSCALE;
+  compare("384x384 -> 192x192 resize gray", run_image_resize, run_image_resize_planned,
+          ml, ml_planned, ML_WIDTH * ML_HEIGHT, iterations);
+
+  return (test_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Host emulation of the Helium (MVE) intrinsics used by
+  image_processing_func_mve.c.
+
+  Vectors are plain lane arrays and every intrinsic is evaluated lane by
+  lane, following the Arm MVE intrinsics reference. A predicate holds one
+  bit per vector byte, as on the target, so a 16-bit lane is active when
+  its low predicate bit is set. Only meant for checking the kernels against
+  the scalar defaults on the host, not for speed.
+*/
+
+#ifndef ARM_MVE_HOST_H
+#define ARM_MVE_HOST_H
+
+#include <stdint.h>
+
+typedef uint16_t mve_pred16_t;
+
+typedef struct { uint8_t  v[16]; } uint8x16_t;
+typedef struct { uint16_t v[8];  } uint16x8_t;
+
+/* Lane i of a 16-bit vector is active */
+#define MVE_P16(p, i)  ((((p) >> (2 * (i))) & 1U) != 0U)
+/* Lane i of an 8-bit vector is active */
+#define MVE_P8(p, i)   ((((p) >> (i)) & 1U) != 0U)
+
+/* Predicates */
+
+static inline mve_pred16_t vctp8q(uint32_t n) {
+  mve_pred16_t p = 0U;
+  for (uint32_t i = 0U; (i < 16U) && (i < n); ++i) {
+    p |= (mve_pred16_t)(1U << i);
+  }
+  return p;
+}
+
+static inline mve_pred16_t vctp16q(uint32_t n) {
+  mve_pred16_t p = 0U;
+  for (uint32_t i = 0U; (i < 8U) && (i < n); ++i) {
+    p |= (mve_pred16_t)(3U << (2U * i));
+  }
+  return p;
+}
+
+static inline mve_pred16_t vpnot(mve_pred16_t p) {
+  return (mve_pred16_t)~p;
+}
+
+static inline mve_pred16_t vcmpeqq_n_u16(uint16x8_t a, uint16_t b) {
+  mve_pred16_t p = 0U;
+  for (int i = 0; i < 8; ++i) {
+    if (a.v[i] == b) {
+      p |= (mve_pred16_t)(3U << (2 * i));
+    }
+  }
+  return p;
+}
+
+static inline mve_pred16_t vcmpneq_n_u16(uint16x8_t a, uint16_t b) {
+  return vpnot(vcmpeqq_n_u16(a, b));
+}
+
+/* 8-bit lanes */
+
+static inline uint8x16_t vdupq_n_u8(uint8_t a) {
+  uint8x16_t r;
+  for (int i = 0; i < 16; ++i) { r.v[i] = a; }
+  return r;
+}
+
+static inline uint8x16_t veorq_u8(uint8x16_t a, uint8x16_t b) {
+  for (int i = 0; i < 16; ++i) { a.v[i] ^= b.v[i]; }
+  return a;
+}
+
+static inline uint8x16_t vld1q_u8(const uint8_t *base) {
+  uint8x16_t r;
+  for (int i = 0; i < 16; ++i) { r.v[i] = base[i]; }
+  return r;
+}
+
+static inline uint8x16_t vld1q_z_u8(const uint8_t *base, mve_pred16_t p) {
+  uint8x16_t r;
+  for (int i = 0; i < 16; ++i) { r.v[i] = MVE_P8(p, i) ? base[i] : 0U; }
+  return r;
+}
+
+static inline void vst1q_u8(uint8_t *base, uint8x16_t a) {
+  for (int i = 0; i < 16; ++i) { base[i] = a.v[i]; }
+}
+
+static inline void vst1q_p_u8(uint8_t *base, uint8x16_t a, mve_pred16_t p) {
+  for (int i = 0; i < 16; ++i) {
+    if (MVE_P8(p, i)) { base[i] = a.v[i]; }
+  }
+}
+
+static inline uint32_t vabavq_p_u8(uint32_t acc, uint8x16_t a, uint8x16_t b, mve_pred16_t p) {
+  for (int i = 0; i < 16; ++i) {
+    if (MVE_P8(p, i)) { acc += (a.v[i] > b.v[i]) ? (uint32_t)(a.v[i] - b.v[i]) : (uint32_t)(b.v[i] - a.v[i]); }
+  }
+  return acc;
+}
+
+/* 16-bit lanes */
+
+static inline uint16x8_t vdupq_n_u16(uint16_t a) {
+  uint16x8_t r;
+  for (int i = 0; i < 8; ++i) { r.v[i] = a; }
+  return r;
+}
+
+static inline uint16x8_t vidupq_n_u16(uint32_t a, int imm) {
+  uint16x8_t r;
+  for (int i = 0; i < 8; ++i) { r.v[i] = (uint16_t)(a + (uint32_t)(i * imm)); }
+  return r;
+}
+
+static inline uint16x8_t vaddq_u16(uint16x8_t a, uint16x8_t b) {
+  for (int i = 0; i < 8; ++i) { a.v[i] = (uint16_t)(a.v[i] + b.v[i]); }
+  return a;
+}
+
+static inline uint16x8_t vaddq_n_u16(uint16x8_t a, uint16_t b) {
+  for (int i = 0; i < 8; ++i) { a.v[i] = (uint16_t)(a.v[i] + b); }
+  return a;
+}
+
+static inline uint16x8_t vsubq_n_u16(uint16x8_t a, uint16_t b) {
+  for (int i = 0; i < 8; ++i) { a.v[i] = (uint16_t)(a.v[i] - b); }
+  return a;
+}
+
+static inline uint16x8_t vmulq_n_u16(uint16x8_t a, uint16_t b) {
+  for (int i = 0; i < 8; ++i) { a.v[i] = (uint16_t)(a.v[i] * b); }
+  return a;
+}
+
+static inline uint16x8_t vandq_u16(uint16x8_t a, uint16x8_t b) {
+  for (int i = 0; i < 8; ++i) { a.v[i] &= b.v[i]; }
+  return a;
+}
+
+static inline uint16x8_t veorq_u16(uint16x8_t a, uint16x8_t b) {
+  for (int i = 0; i < 8; ++i) { a.v[i] ^= b.v[i]; }
+  return a;
+}
+
+static inline uint16x8_t vshrq_n_u16(uint16x8_t a, int imm) {
+  for (int i = 0; i < 8; ++i) { a.v[i] = (uint16_t)(a.v[i] >> imm); }
+  return a;
+}
+
+/* Rounding shift, a negative shift count shifts right */
+static inline uint16x8_t vrshlq_n_u16(uint16x8_t a, int32_t b) {
+  for (int i = 0; i < 8; ++i) {
+    const uint32_t x = a.v[i];
+    a.v[i] = (uint16_t)((b >= 0) ? (x << b) : ((x + (1U << (-b - 1))) >> -b));
+  }
+  return a;
+}
+
+static inline uint16x8_t vpselq_u16(uint16x8_t a, uint16x8_t b, mve_pred16_t p) {
+  for (int i = 0; i < 8; ++i) {
+    if (!MVE_P16(p, i)) { a.v[i] = b.v[i]; }
+  }
+  return a;
+}
+
+static inline uint16x8_t vldrhq_u16(const uint16_t *base) {
+  uint16x8_t r;
+  for (int i = 0; i < 8; ++i) { r.v[i] = base[i]; }
+  return r;
+}
+
+static inline uint16x8_t vldrhq_z_u16(const uint16_t *base, mve_pred16_t p) {
+  uint16x8_t r;
+  for (int i = 0; i < 8; ++i) { r.v[i] = MVE_P16(p, i) ? base[i] : 0U; }
+  return r;
+}
+
+static inline uint16x8_t vldrbq_z_u16(const uint8_t *base, mve_pred16_t p) {
+  uint16x8_t r;
+  for (int i = 0; i < 8; ++i) { r.v[i] = MVE_P16(p, i) ? base[i] : 0U; }
+  return r;
+}
+
+static inline uint16x8_t vldrbq_gather_offset_z_u16(const uint8_t *base, uint16x8_t offset, mve_pred16_t p) {
+  uint16x8_t r;
+  for (int i = 0; i < 8; ++i) { r.v[i] = MVE_P16(p, i) ? base[offset.v[i]] : 0U; }
+  return r;
+}
+
+static inline void vstrbq_p_u16(uint8_t *base, uint16x8_t value, mve_pred16_t p) {
+  for (int i = 0; i < 8; ++i) {
+    if (MVE_P16(p, i)) { base[i] = (uint8_t)value.v[i]; }
+  }
+}
+
+static inline void vstrbq_scatter_offset_p_u16(uint8_t *base, uint16x8_t offset, uint16x8_t value, mve_pred16_t p) {
+  for (int i = 0; i < 8; ++i) {
+    if (MVE_P16(p, i)) { base[offset.v[i]] = (uint8_t)value.v[i]; }
+  }
+}
+
+#endif /* ARM_MVE_HOST_H */
@@ -0,0 +1,31 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Host replacement of the CMSIS compiler header, provides only what the
+  image processing functions use.
+*/
+
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#ifndef __WEAK
+#define __WEAK  __attribute__((weak))
+#endif
+
+#endif /* CMSIS_COMPILER_H */
@@ -0,0 +1,39 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Host build of the Helium (MVE) image processing functions.
+
+  The functions are renamed with an mve_ prefix, so they do not override
+  the __WEAK scalar defaults (see image_processing_func_mve_host.h).
+*/
+
+#define __ARM_FEATURE_MVE   1
+
+#define crop_and_debayer              mve_crop_and_debayer
+#define crop_and_debayer_to_input     mve_crop_and_debayer_to_input
+#define crop_and_debayer_planned      mve_crop_and_debayer_planned
+#define crop_and_debayer_planned_gray mve_crop_and_debayer_planned_gray
+#define crop_and_debayer_decimate     mve_crop_and_debayer_decimate
+#define image_debayer                 mve_image_debayer
+#define image_sad                     mve_image_sad
+#define image_to_int8                 mve_image_to_int8
+#define image_gray_to_rgb888          mve_image_gray_to_rgb888
+#define image_fill_rgb888             mve_image_fill_rgb888
+
+#include "image_processing_func_mve.c"
@@ -0,0 +1,101 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Helium (MVE) image processing functions built for the host.
+
+  image_processing_func_mve_host.c compiles image_processing_func_mve.c
+  against the intrinsic emulation in host/arm_mve.h. Its functions are
+  exported with an mve_ prefix, so a test can compare them with the scalar
+  defaults from image_processing_func.c in the same program.
+*/
+
+#ifndef IMAGE_PROCESSING_FUNC_MVE_HOST_H__
+#define IMAGE_PROCESSING_FUNC_MVE_HOST_H__
+
+#include "image_processing_func.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void mve_image_debayer(const uint8_t *raw,
+                       uint8_t *rgb,
+                       int width,
+                       int height,
+                       bayer_pattern_t pattern,
+                       int swap_rb);
+
+void mve_crop_and_debayer(const uint8_t *src,
+                          int src_width,
+                          int src_height,
+                          int src_crop_x,
+                          int src_crop_y,
+                          uint8_t *dst_rgb,
+                          int dst_width,
+                          int dst_height,
+                          bayer_pattern_t pattern);
+
+void mve_crop_and_debayer_to_input(const uint8_t *src,
+                                   int src_width,
+                                   int src_height,
+                                   int src_crop_x,
+                                   int src_crop_y,
+                                   void *dst,
+                                   int dst_width,
+                                   int dst_height,
+                                   bayer_pattern_t pattern,
+                                   image_format_t dst_format,
+                                   int is_signed);
+
+void mve_crop_and_debayer_planned(const crop_and_debayer_plan_t *plan,
+                                  const uint8_t *src,
+                                  void *dst,
+                                  bayer_pattern_t pattern,
+                                  int is_signed);
+
+void mve_crop_and_debayer_planned_gray(const crop_and_debayer_plan_t *plan,
+                                       const uint8_t *src,
+                                       uint8_t *dst,
+                                       bayer_pattern_t pattern,
+                                       int is_signed);
+
+void mve_crop_and_debayer_decimate(const uint8_t *src,
+                                   int src_width,
+                                   int src_height,
+                                   int src_crop_x,
+                                   int src_crop_y,
+                                   uint8_t *dst_rgb,
+                                   int dst_width,
+                                   int dst_height,
+                                   int factor,
+                                   bayer_pattern_t pattern);
+
+void mve_image_gray_to_rgb888(const uint8_t *src,
+                              int src_stride,
+                              uint8_t *dst,
+                              int dst_stride,
+                              int width,
+                              int height,
+                              int is_signed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMAGE_PROCESSING_FUNC_MVE_HOST_H__ */
@@ -0,0 +1,113 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Helpers shared by the image processing host tests.
+*/
+
+#ifndef TEST_COMMON_H__
+#define TEST_COMMON_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Number of failed checks */
+static int test_failures = 0;
+
+/*
+  Get next value of a deterministic pseudo-random sequence.
+
+  \param[in,out] state  Generator state.
+  \return               Pseudo-random 32-bit value.
+*/
+static inline uint32_t test_rand(uint32_t *state) {
+  /* xorshift32 */
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+/*
+  Fill a buffer with pseudo-random bytes.
+
+  \param[out]    buf    Pointer to the buffer.
+  \param[in]     size   Size of the buffer in bytes.
+  \param[in,out] state  Generator state.
+*/
+static inline void test_fill_random(uint8_t *buf, int size, uint32_t *state) {
+  for (int i = 0; i < size; ++i) {
+    buf[i] = (uint8_t)(test_rand(state) >> 24);
+  }
+}
+
+/*
+  Allocate a buffer, exit the test on failure.
+
+  \param[in] size  Size of the buffer in bytes.
+  \return          Pointer to the buffer.
+*/
+static inline void *test_alloc(size_t size) {
+  void *buf = malloc((size != 0U) ? size : 1U);
+  if (buf == NULL) {
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+  }
+  return buf;
+}
+
+/*
+  Compare two buffers byte for byte and report the first difference.
+
+  \param[in] name      Name of the checked case.
+  \param[in] expected  Pointer to the expected data.
+  \param[in] actual    Pointer to the actual data.
+  \param[in] size      Size of the data in bytes.
+  \return              1 if the buffers are equal, otherwise 0.
+*/
+static inline int test_check_equal(const char *name, const uint8_t *expected, const uint8_t *actual, int size) {
+  for (int i = 0; i < size; ++i) {
+    if (expected[i] != actual[i]) {
+      fprintf(stderr, "FAIL %s: byte %d is %u, expected %u\n", name, i, actual[i], expected[i]);
+      test_failures++;
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*
+  Report the test result.
+
+  \param[in] test    Name of the test.
+  \param[in] checks  Number of checked cases.
+  \return            Exit code of the test program.
+*/
+static inline int test_report(const char *test, int checks) {
+  if (test_failures != 0) {
+    printf("%s: %d of %d checks failed\n", test, test_failures, checks);
+    return 1;
+  }
+  printf("%s: %d checks passed\n", test, checks);
+  return 0;
+}
+
+#endif /* TEST_COMMON_H__ */
@@ -0,0 +1,214 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Equivalence test of the crop and debayer functions.
+
+  The scalar, Helium and planned implementations are compared byte for
+  byte with a reference copy of the original scalar algorithm, for all Bayer
+  patterns, even and odd crop offsets and output widths that are not a
+  multiple of the vector length. Model input is checked as RGB888 and as
+  grayscale, uint8 and int8.
+*/
+
+#include <string.h>
+
+#include "image_processing_func.h"
+#include "image_processing_func_mve_host.h"
+#include "test_common.h"
+
+/*
+  Reference crop and debayer, the original scalar implementation: nearest
+  source site, missing colours averaged from the 3x3 neighbourhood. Green
+  sites take red from the row neighbours when row and column parity differ.
+*/
+static void ref_crop_and_debayer(const uint8_t *src,
+                                 int src_width,
+                                 int src_height,
+                                 int src_crop_x,
+                                 int src_crop_y,
+                                 uint8_t *dst_rgb,
+                                 int dst_width,
+                                 int dst_height,
+                                 bayer_pattern_t pattern) {
+  /* Colour of each site (0 = blue, 1 = green, 2 = red), indexed by [row parity][column parity] */
+  static const int sites[4][2][2] = {
+    [BAYER_PATTERN_RGGB] = { { 2, 1 }, { 1, 0 } },
+    [BAYER_PATTERN_BGGR] = { { 0, 1 }, { 1, 2 } },
+    [BAYER_PATTERN_GRBG] = { { 1, 2 }, { 0, 1 } },
+    [BAYER_PATTERN_GBRG] = { { 1, 0 }, { 2, 1 } },
+  };
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    int sy = src_crop_y + ((dy * (src_height - 2 - src_crop_y * 2) << 8) / (dst_height - 1) >> 8);
+    sy = (sy < 1) ? 1 : (sy > src_height - 2) ? (src_height - 2) : sy;
+
+    for (int dx = 0; dx < dst_width; ++dx) {
+      int sx = src_crop_x + ((dx * (src_width - 2 - src_crop_x * 2) << 8) / (dst_width - 1) >> 8);
+      sx = (sx < 1) ? 1 : (sx > src_width - 2) ? (src_width - 2) : sx;
+
+      const uint8_t *c = &src[sy * src_width + sx];
+      const int horz  = (c[-1] + c[1]) / 2;
+      const int vert  = (c[-src_width] + c[src_width]) / 2;
+      const int cross = (c[-1] + c[1] + c[-src_width] + c[src_width]) / 4;
+      const int diag  = (c[-src_width - 1] + c[-src_width + 1] + c[src_width - 1] + c[src_width + 1]) / 4;
+      const int site  = sites[pattern][sy & 1][sx & 1];
+      const int r_horz = ((sy & 1) != (sx & 1));
+      uint8_t *px = &dst_rgb[(dy * dst_width + dx) * 3];
+
+      if (site == 1) {
+        px[0] = (uint8_t)(r_horz ? horz : vert);
+        px[1] = c[0];
+        px[2] = (uint8_t)(r_horz ? vert : horz);
+      } else {
+        px[0] = (uint8_t)((site == 2) ? c[0] : diag);
+        px[1] = (uint8_t)cross;
+        px[2] = (uint8_t)((site == 0) ? c[0] : diag);
+      }
+    }
+  }
+}
+
+int main(void) {
+  static const int src_sizes[][2] = { { 64, 48 }, { 97, 61 }, { 320, 240 } };
+  static const int crops[][2]     = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 }, { 5, 3 }, { 16, 7 } };
+  static const int dst_sizes[][2] = { { 2, 2 }, { 8, 8 }, { 37, 23 }, { 64, 40 }, { 133, 91 } };
+  const int max_dst = 133 * 91 * 3;
+
+  uint32_t seed = 0x12345678U;
+  uint8_t *expected = test_alloc(max_dst);
+  uint8_t *actual   = test_alloc(max_dst);
+  uint8_t *gray     = test_alloc(max_dst / 3);
+  uint16_t *plan_buf = test_alloc(CROP_AND_DEBAYER_PLAN_BUF_SIZE(133, 91) * sizeof(uint16_t));
+  int checks = 0;
+  char name[128];
+
+  for (size_t s = 0; s < sizeof(src_sizes) / sizeof(src_sizes[0]); ++s) {
+    const int src_width  = src_sizes[s][0];
+    const int src_height = src_sizes[s][1];
+    uint8_t *src = test_alloc((size_t)src_width * src_height);
+
+    test_fill_random(src, src_width * src_height, &seed);
+
+    for (size_t c = 0; c < sizeof(crops) / sizeof(crops[0]); ++c) {
+      const int crop_x = crops[c][0];
+      const int crop_y = crops[c][1];
+
+      for (size_t d = 0; d < sizeof(dst_sizes) / sizeof(dst_sizes[0]); ++d) {
+        const int dst_width  = dst_sizes[d][0];
+        const int dst_height = dst_sizes[d][1];
+        const size_t dst_size = (size_t)dst_width * (size_t)dst_height * 3U;
+        crop_and_debayer_plan_t plan;
+
+        crop_and_debayer_plan_init(&plan, plan_buf, src_width, src_height, crop_x, crop_y,
+                                   dst_width, dst_height);
+
+        for (bayer_pattern_t pattern = BAYER_PATTERN_RGGB; pattern <= BAYER_PATTERN_GBRG; ++pattern) {
+          snprintf(name, sizeof(name), "%dx%d crop (%d,%d) -> %dx%d pattern %d",
+                   src_width, src_height, crop_x, crop_y, dst_width, dst_height, pattern);
+
+          ref_crop_and_debayer(src, src_width, src_height, crop_x, crop_y,
+                               expected, dst_width, dst_height, pattern);
+
+          memset(actual, 0xA5, dst_size);
+          crop_and_debayer(src, src_width, src_height, crop_x, crop_y,
+                           actual, dst_width, dst_height, pattern);
+          test_check_equal(name, expected, actual, (int)dst_size);
+
+          memset(actual, 0xA5, dst_size);
+          mve_crop_and_debayer(src, src_width, src_height, crop_x, crop_y,
+                               actual, dst_width, dst_height, pattern);
+          test_check_equal(name, expected, actual, (int)dst_size);
+
+          memset(actual, 0xA5, dst_size);
+          crop_and_debayer_planned(&plan, src, actual, pattern, 0);
+          test_check_equal(name, expected, actual, (int)dst_size);
+
+          memset(actual, 0xA5, dst_size);
+          mve_crop_and_debayer_planned(&plan, src, actual, pattern, 0);
+          test_check_equal(name, expected, actual, (int)dst_size);
+          checks += 4;
+
+          /* Grayscale model input is the luma of the RGB output */
+          for (size_t i = 0; i < dst_size / 3; ++i) {
+            gray[i] = (uint8_t)((expected[i * 3] * 77 + expected[i * 3 + 1] * 150 + expected[i * 3 + 2] * 29) >> 8);
+          }
+
+          for (int is_signed = 0; is_signed <= 1; ++is_signed) {
+            const uint8_t mask = (is_signed != 0) ? 0x80U : 0x00U;
+
+            for (size_t i = 0; i < dst_size / 3; ++i) {
+              gray[i] ^= mask;
+            }
+
+            memset(actual, 0xA5, dst_size);
+            crop_and_debayer_to_input(src, src_width, src_height, crop_x, crop_y, actual,
+                                      dst_width, dst_height, pattern, IMAGE_FORMAT_GRAYSCALE, is_signed);
+            test_check_equal(name, gray, actual, (int)dst_size / 3);
+
+            memset(actual, 0xA5, dst_size);
+            mve_crop_and_debayer_to_input(src, src_width, src_height, crop_x, crop_y, actual,
+                                          dst_width, dst_height, pattern, IMAGE_FORMAT_GRAYSCALE, is_signed);
+            test_check_equal(name, gray, actual, (int)dst_size / 3);
+
+            memset(actual, 0xA5, dst_size);
+            crop_and_debayer_planned_gray(&plan, src, actual, pattern, is_signed);
+            test_check_equal(name, gray, actual, (int)dst_size / 3);
+
+            memset(actual, 0xA5, dst_size);
+            mve_crop_and_debayer_planned_gray(&plan, src, actual, pattern, is_signed);
+            test_check_equal(name, gray, actual, (int)dst_size / 3);
+            checks += 4;
+
+            for (size_t i = 0; i < dst_size / 3; ++i) {
+              gray[i] ^= mask;
+            }
+          }
+
+          /* Signed model input is the unsigned output minus 128 */
+          for (size_t i = 0; i < dst_size; ++i) {
+            expected[i] ^= 0x80U;
+          }
+
+          memset(actual, 0xA5, dst_size);
+          crop_and_debayer_to_input(src, src_width, src_height, crop_x, crop_y,
+                                    actual, dst_width, dst_height, pattern, IMAGE_FORMAT_RGB888, 1);
+          test_check_equal(name, expected, actual, (int)dst_size);
+
+          memset(actual, 0xA5, dst_size);
+          mve_crop_and_debayer_to_input(src, src_width, src_height, crop_x, crop_y,
+                                        actual, dst_width, dst_height, pattern, IMAGE_FORMAT_RGB888, 1);
+          test_check_equal(name, expected, actual, (int)dst_size);
+
+          memset(actual, 0xA5, dst_size);
+          mve_crop_and_debayer_planned(&plan, src, actual, pattern, 1);
+          test_check_equal(name, expected, actual, (int)dst_size);
+          checks += 3;
+        }
+      }
+    }
+    free(src);
+  }
+
+  free(plan_buf);
+  free(gray);
+  free(actual);
+  free(expected);
+
+  return test_report("crop_and_debayer", checks);
+}
@@ -0,0 +1,158 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Equivalence test of the Helium debayer kernels.
+
+  The Helium kernels are compared byte for byte with the scalar defaults,
+  for all Bayer patterns and even and odd image geometry.
+*/
+
+#include <string.h>
+
+#include "image_processing_func.h"
+#include "image_processing_func_mve_host.h"
+#include "test_common.h"
+
+static int test_debayer(uint32_t *seed) {
+  static const int sizes[][2] = { { 2, 2 }, { 3, 5 }, { 8, 4 }, { 9, 7 }, { 17, 16 }, { 64, 48 }, { 97, 61 } };
+  uint8_t *raw      = test_alloc(97 * 61);
+  uint8_t *expected = test_alloc(97 * 61 * 3);
+  uint8_t *actual   = test_alloc(97 * 61 * 3);
+  char name[96];
+  int checks = 0;
+
+  for (size_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n) {
+    const int width  = sizes[n][0];
+    const int height = sizes[n][1];
+    const int size   = width * height * 3;
+
+    test_fill_random(raw, width * height, seed);
+
+    for (bayer_pattern_t pattern = BAYER_PATTERN_RGGB; pattern <= BAYER_PATTERN_GBRG; ++pattern) {
+      for (int swap_rb = 0; swap_rb <= 1; ++swap_rb) {
+        snprintf(name, sizeof(name), "image_debayer %dx%d pattern %d swap %d", width, height, pattern, swap_rb);
+
+        memset(expected, 0x5A, size);
+        image_debayer(raw, expected, width, height, pattern, swap_rb);
+        memset(actual, 0xA5, size);
+        mve_image_debayer(raw, actual, width, height, pattern, swap_rb);
+        test_check_equal(name, expected, actual, size);
+        checks++;
+      }
+    }
+  }
+
+  free(actual);
+  free(expected);
+  free(raw);
+  return checks;
+}
+
+static int test_decimate(uint32_t *seed) {
+  static const int crops[][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 3, 5 } };
+  static const int dst_sizes[][2] = { { 1, 1 }, { 7, 3 }, { 8, 8 }, { 19, 11 } };
+  const int src_width  = 160;
+  const int src_height = 96;
+  uint8_t *src      = test_alloc((size_t)src_width * src_height);
+  uint8_t *expected = test_alloc(19 * 11 * 3);
+  uint8_t *actual   = test_alloc(19 * 11 * 3);
+  char name[128];
+  int checks = 0;
+
+  test_fill_random(src, src_width * src_height, seed);
+
+  for (int factor = 2; factor <= 8; factor *= 2) {
+    for (size_t c = 0; c < sizeof(crops) / sizeof(crops[0]); ++c) {
+      for (size_t d = 0; d < sizeof(dst_sizes) / sizeof(dst_sizes[0]); ++d) {
+        const int dst_width  = dst_sizes[d][0];
+        const int dst_height = dst_sizes[d][1];
+        const int dst_size   = dst_width * dst_height * 3;
+
+        for (bayer_pattern_t pattern = BAYER_PATTERN_RGGB; pattern <= BAYER_PATTERN_GBRG; ++pattern) {
+          snprintf(name, sizeof(name), "crop_and_debayer_decimate crop (%d,%d) -> %dx%d factor %d pattern %d",
+                   crops[c][0], crops[c][1], dst_width, dst_height, factor, pattern);
+
+          memset(expected, 0x5A, dst_size);
+          crop_and_debayer_decimate(src, src_width, src_height, crops[c][0], crops[c][1],
+                                    expected, dst_width, dst_height, factor, pattern);
+          memset(actual, 0xA5, dst_size);
+          mve_crop_and_debayer_decimate(src, src_width, src_height, crops[c][0], crops[c][1],
+                                        actual, dst_width, dst_height, factor, pattern);
+          test_check_equal(name, expected, actual, dst_size);
+          checks++;
+        }
+      }
+    }
+  }
+
+  free(actual);
+  free(expected);
+  free(src);
+  return checks;
+}
+
+/* Crop regions outside of the source image are rejected without writing */
+static int test_decimate_bounds(uint32_t *seed) {
+  /* Crop x, crop y, output width, output height of a 16x12 image at factor 4 */
+  static const int regions[][4] = { { 1, 0, 4, 3 }, { 0, 1, 4, 3 }, { 0, 0, 5, 1 }, { 0, 0, 1, 4 }, { -2, 0, 1, 1 }, { 0, -2, 1, 1 } };
+  const int src_width  = 16;
+  const int src_height = 12;
+  uint8_t *src      = test_alloc((size_t)src_width * src_height);
+  uint8_t *expected = test_alloc(5 * 4 * 3);
+  uint8_t *actual   = test_alloc(5 * 4 * 3);
+  char name[128];
+  int checks = 0;
+
+  test_fill_random(src, src_width * src_height, seed);
+  memset(expected, 0x5A, 5 * 4 * 3);
+
+  for (size_t r = 0; r < sizeof(regions) / sizeof(regions[0]); ++r) {
+    for (int mve = 0; mve <= 1; ++mve) {
+      snprintf(name, sizeof(name), "%scrop_and_debayer_decimate outside crop (%d,%d) -> %dx%d",
+               mve ? "mve_" : "", regions[r][0], regions[r][1], regions[r][2], regions[r][3]);
+
+      memset(actual, 0x5A, 5 * 4 * 3);
+      if (mve) {
+        mve_crop_and_debayer_decimate(src, src_width, src_height, regions[r][0], regions[r][1],
+                                      actual, regions[r][2], regions[r][3], 4, BAYER_PATTERN_GBRG);
+      } else {
+        crop_and_debayer_decimate(src, src_width, src_height, regions[r][0], regions[r][1],
+                                  actual, regions[r][2], regions[r][3], 4, BAYER_PATTERN_GBRG);
+      }
+      test_check_equal(name, expected, actual, 5 * 4 * 3);
+      checks++;
+    }
+  }
+
+  free(actual);
+  free(expected);
+  free(src);
+  return checks;
+}
+
+int main(void) {
+  uint32_t seed = 0x0BADCAFEU;
+  int checks = 0;
+
+  checks += test_debayer(&seed);
+  checks += test_decimate(&seed);
+  checks += test_decimate_bounds(&seed);
+
+  return test_report("debayer_mve", checks);
+}
@@ -0,0 +1,82 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Test of the grayscale to RGB888 expansion.
+
+  The scalar and Helium versions are compared with a reference for widths
+  around the vector length, padded source and destination lines and uint8
+  and int8 gray values. Bytes outside of the image must stay untouched.
+*/
+
+#include <string.h>
+
+#include "image_processing_func.h"
+#include "image_processing_func_mve_host.h"
+#include "test_common.h"
+
+#define MAX_WIDTH   40
+#define HEIGHT      5
+#define SRC_STRIDE  (MAX_WIDTH + 3)
+#define DST_STRIDE  (MAX_WIDTH * 3 + 5)
+
+static void ref_gray_to_rgb888(const uint8_t *src, uint8_t *dst, int width, int is_signed) {
+  for (int y = 0; y < HEIGHT; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const uint8_t v = (uint8_t)(src[y * SRC_STRIDE + x] + (is_signed ? 128 : 0));
+      memset(&dst[y * DST_STRIDE + x * 3], v, 3);
+    }
+  }
+}
+
+int main(void) {
+  uint8_t *src      = test_alloc(SRC_STRIDE * HEIGHT);
+  uint8_t *expected = test_alloc(DST_STRIDE * HEIGHT);
+  uint8_t *actual   = test_alloc(DST_STRIDE * HEIGHT);
+  uint32_t seed = 0x5EED1234U;
+  char name[96];
+  int checks = 0;
+
+  for (int width = 1; width <= MAX_WIDTH; ++width) {
+    test_fill_random(src, SRC_STRIDE * HEIGHT, &seed);
+
+    for (int is_signed = 0; is_signed <= 1; ++is_signed) {
+      memset(expected, 0x5A, DST_STRIDE * HEIGHT);
+      ref_gray_to_rgb888(src, expected, width, is_signed);
+
+      for (int mve = 0; mve <= 1; ++mve) {
+        snprintf(name, sizeof(name), "%simage_gray_to_rgb888 width %d signed %d", mve ? "mve_" : "", width, is_signed);
+
+        memset(actual, 0x5A, DST_STRIDE * HEIGHT);
+        if (mve) {
+          mve_image_gray_to_rgb888(src, SRC_STRIDE, actual, DST_STRIDE, width, HEIGHT, is_signed);
+        } else {
+          image_gray_to_rgb888(src, SRC_STRIDE, actual, DST_STRIDE, width, HEIGHT, is_signed);
+        }
+        test_check_equal(name, expected, actual, DST_STRIDE * HEIGHT);
+        checks++;
+      }
+    }
+  }
+
+  free(actual);
+  free(expected);
+  free(src);
+
+  return test_report("gray_to_rgb888", checks);
+}
@@ -0,0 +1,230 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Equivalence test of the streaming image processing functions.
+
+  Source rows are pushed in chunks of random size, the output rows are
+  collected from the callback and compared byte for byte with the output
+  of the one-shot functions. Every output row must be delivered exactly
+  once and in order.
+*/
+
+#include <string.h>
+
+#include "image_processing_func.h"
+#include "test_common.h"
+
+/* Largest number of rows pushed at once */
+#define MAX_CHUNK_ROWS  9
+
+/* Collected output of a stream */
+typedef struct {
+  uint8_t *image;       /* Output image */
+  int      row_bytes;   /* Size of an output row in bytes */
+  int      rows;        /* Number of rows received */
+  int      in_order;    /* Rows were received in order */
+} stream_output_t;
+
+/*
+  Output row callback, copies the row into the output image.
+*/
+static void collect_row(const uint8_t *row, int y, void *arg) {
+  stream_output_t *out = (stream_output_t *)arg;
+
+  if (y != out->rows) {
+    out->in_order = 0;
+  }
+  memcpy(&out->image[y * out->row_bytes], row, out->row_bytes);
+  out->rows++;
+}
+
+/*
+  Check the collected output of a stream.
+*/
+static void check_output(const char *name, const stream_output_t *out, const uint8_t *expected, int height) {
+  if ((out->rows != height) || (out->in_order == 0)) {
+    fprintf(stderr, "FAIL %s: %d rows received, expected %d in order\n", name, out->rows, height);
+    test_failures++;
+    return;
+  }
+  test_check_equal(name, expected, out->image, height * out->row_bytes);
+}
+
+/*
+  Get number of rows of the next chunk.
+*/
+static int chunk_rows(int remaining, uint32_t *seed) {
+  int n = 1 + (int)(test_rand(seed) % MAX_CHUNK_ROWS);
+  return (n < remaining) ? n : remaining;
+}
+
+static int test_debayer_stream(int width, int height, uint32_t *seed) {
+  const int size = width * height * 3;
+  uint8_t *raw      = test_alloc((size_t)width * height);
+  uint8_t *expected = test_alloc(size);
+  uint8_t *line_buf = test_alloc((size_t)IMAGE_DEBAYER_STREAM_LINES * width);
+  uint8_t *out_row  = test_alloc((size_t)width * 3);
+  stream_output_t out = { test_alloc(size), width * 3, 0, 1 };
+  char name[96];
+  int checks = 0;
+
+  test_fill_random(raw, width * height, seed);
+
+  for (bayer_pattern_t pattern = BAYER_PATTERN_RGGB; pattern <= BAYER_PATTERN_GBRG; ++pattern) {
+    for (int swap_rb = 0; swap_rb <= 1; ++swap_rb) {
+      image_debayer_stream_t stream;
+
+      snprintf(name, sizeof(name), "image_debayer_stream %dx%d pattern %d swap %d",
+               width, height, pattern, swap_rb);
+
+      image_debayer(raw, expected, width, height, pattern, swap_rb);
+
+      out.rows = 0;
+      out.in_order = 1;
+      memset(out.image, 0xA5, size);
+      image_debayer_stream_init(&stream, width, height, pattern, swap_rb, line_buf, out_row, collect_row, &out);
+      for (int y = 0; y < height; ) {
+        const int n = chunk_rows(height - y, seed);
+        image_debayer_stream_push(&stream, &raw[y * width], n);
+        y += n;
+      }
+      check_output(name, &out, expected, height);
+      checks++;
+    }
+  }
+
+  free(out.image);
+  free(out_row);
+  free(line_buf);
+  free(expected);
+  free(raw);
+  return checks;
+}
+
+static int test_crop_and_debayer_stream(int src_width, int src_height, int crop_x, int crop_y,
+                                        int dst_width, int dst_height, uint32_t *seed) {
+  const int size = dst_width * dst_height * 3;
+  uint8_t *raw      = test_alloc((size_t)src_width * src_height);
+  uint8_t *expected = test_alloc(size);
+  uint8_t *line_buf = test_alloc((size_t)IMAGE_DEBAYER_STREAM_LINES * src_width);
+  uint8_t *out_row  = test_alloc((size_t)dst_width * 3);
+  stream_output_t out = { test_alloc(size), dst_width * 3, 0, 1 };
+  char name[128];
+  int checks = 0;
+
+  test_fill_random(raw, src_width * src_height, seed);
+
+  for (bayer_pattern_t pattern = BAYER_PATTERN_RGGB; pattern <= BAYER_PATTERN_GBRG; ++pattern) {
+    crop_and_debayer_stream_t stream;
+
+    snprintf(name, sizeof(name), "crop_and_debayer_stream %dx%d crop (%d,%d) -> %dx%d pattern %d",
+             src_width, src_height, crop_x, crop_y, dst_width, dst_height, pattern);
+
+    crop_and_debayer(raw, src_width, src_height, crop_x, crop_y, expected, dst_width, dst_height, pattern);
+
+    out.rows = 0;
+    out.in_order = 1;
+    memset(out.image, 0xA5, size);
+    crop_and_debayer_stream_init(&stream, src_width, src_height, crop_x, crop_y, dst_width, dst_height,
+                                 pattern, line_buf, out_row, collect_row, &out);
+    for (int y = 0; y < src_height; ) {
+      const int n = chunk_rows(src_height - y, seed);
+      crop_and_debayer_stream_push(&stream, &raw[y * src_width], n);
+      y += n;
+    }
+    check_output(name, &out, expected, dst_height);
+    checks++;
+  }
+
+  free(out.image);
+  free(out_row);
+  free(line_buf);
+  free(expected);
+  free(raw);
+  return checks;
+}
+
+static int test_resize_stream(int src_width, int src_height, int dst_width, int dst_height, uint32_t *seed) {
+  static const int bpp[3] = { 1, 2, 3 };   /* Indexed by image format */
+  uint8_t *src      = test_alloc((size_t)src_width * src_height * 3);
+  uint8_t *expected = test_alloc((size_t)dst_width * dst_height * 3);
+  uint8_t *line_buf = test_alloc((size_t)IMAGE_RESIZE_STREAM_LINES * src_width * 3);
+  uint8_t *out_row  = test_alloc((size_t)dst_width * 3);
+  stream_output_t out = { test_alloc((size_t)dst_width * dst_height * 3), 0, 0, 1 };
+  char name[128];
+  int checks = 0;
+
+  test_fill_random(src, src_width * src_height * 3, seed);
+
+  for (image_format_t src_format = IMAGE_FORMAT_GRAYSCALE; src_format <= IMAGE_FORMAT_RGB888; ++src_format) {
+    for (image_format_t dst_format = IMAGE_FORMAT_GRAYSCALE; dst_format <= IMAGE_FORMAT_RGB888; ++dst_format) {
+      const int src_row_bytes = src_width * bpp[src_format];
+      image_resize_stream_t stream;
+
+      snprintf(name, sizeof(name), "image_resize_stream %dx%d -> %dx%d format %d -> %d",
+               src_width, src_height, dst_width, dst_height, src_format, dst_format);
+
+      image_resize(src, src_width, src_height, expected, dst_width, dst_height, src_format, dst_format);
+
+      out.row_bytes = dst_width * bpp[dst_format];
+      out.rows = 0;
+      out.in_order = 1;
+      memset(out.image, 0xA5, (size_t)dst_width * dst_height * 3);
+      image_resize_stream_init(&stream, src_width, src_height, dst_width, dst_height, src_format, dst_format,
+                               line_buf, out_row, collect_row, &out);
+      for (int y = 0; y < src_height; ) {
+        const int n = chunk_rows(src_height - y, seed);
+        image_resize_stream_push(&stream, &src[y * src_row_bytes], n);
+        y += n;
+      }
+      check_output(name, &out, expected, dst_height);
+      checks++;
+    }
+  }
+
+  free(out.image);
+  free(out_row);
+  free(line_buf);
+  free(expected);
+  free(src);
+  return checks;
+}
+
+int main(void) {
+  uint32_t seed = 0x2468ACE1U;
+  int checks = 0;
+
+  /* Every size is run with several random chunk sequences */
+  for (int run = 0; run < 8; ++run) {
+    checks += test_debayer_stream(64, 48, &seed);
+    checks += test_debayer_stream(33, 17, &seed);
+    checks += test_debayer_stream(2, 2, &seed);
+
+    checks += test_crop_and_debayer_stream(64, 48, 0, 0, 64, 48, &seed);
+    checks += test_crop_and_debayer_stream(97, 61, 3, 1, 37, 23, &seed);
+    checks += test_crop_and_debayer_stream(97, 61, 8, 5, 133, 91, &seed);
+    checks += test_crop_and_debayer_stream(320, 240, 40, 0, 96, 96, &seed);
+
+    checks += test_resize_stream(64, 48, 37, 23, &seed);
+    checks += test_resize_stream(23, 17, 64, 40, &seed);
+    checks += test_resize_stream(96, 96, 96, 96, &seed);
+  }
+
+  return test_report("stream", checks);
+}
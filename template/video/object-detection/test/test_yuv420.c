@@ -0,0 +1,277 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2025 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Test of the YUV 4:2:0 crop, resize and conversion.
+
+  The same Y, U and V samples are laid out as I420, NV12 and NV21 frames.
+  RGB888 and RGB565 output of every layout is compared byte for byte with a
+  reference conversion (nearest sample, ITU-R BT.601 limited range). The
+  luma-only grayscale output is compared with the luma of the RGB888 output:
+  exact for neutral chroma and within one level for chroma that does not
+  clip the RGB components.
+*/
+
+#include <string.h>
+
+#include "image_processing_func.h"
+#include "test_common.h"
+
+#define FP_SHIFT  16    /* Fixed-point step of the nearest sampling */
+
+/* Separate Y, U and V planes of a YUV 4:2:0 test image */
+typedef struct {
+  int      width;
+  int      height;
+  uint8_t *y;
+  uint8_t *u;
+  uint8_t *v;
+} yuv_planes_t;
+
+static int clamp_u8(int val) {
+  return (val < 0) ? 0 : (val > 255) ? 255 : val;
+}
+
+/*
+  Fill the planes with random samples in the given ranges.
+*/
+static void fill_planes(yuv_planes_t *img, int y_min, int y_max, int c_min, int c_max, uint32_t *seed) {
+  const int c_size = ((img->width + 1) / 2) * ((img->height + 1) / 2);
+
+  for (int i = 0; i < img->width * img->height; ++i) {
+    img->y[i] = (uint8_t)(y_min + (int)(test_rand(seed) % (uint32_t)(y_max - y_min + 1)));
+  }
+  for (int i = 0; i < c_size; ++i) {
+    img->u[i] = (uint8_t)(c_min + (int)(test_rand(seed) % (uint32_t)(c_max - c_min + 1)));
+    img->v[i] = (uint8_t)(c_min + (int)(test_rand(seed) % (uint32_t)(c_max - c_min + 1)));
+  }
+}
+
+/*
+  Lay the planes out as a YUV 4:2:0 frame.
+*/
+static void pack_frame(const yuv_planes_t *img, yuv_format_t format, uint8_t *frame) {
+  const int y_size = img->width * img->height;
+  const int c_size = ((img->width + 1) / 2) * ((img->height + 1) / 2);
+  uint8_t *chroma = frame + y_size;
+
+  memcpy(frame, img->y, y_size);
+  for (int i = 0; i < c_size; ++i) {
+    switch (format) {
+      case YUV_FORMAT_I420:
+        chroma[i]          = img->u[i];
+        chroma[c_size + i] = img->v[i];
+        break;
+      case YUV_FORMAT_NV12:
+        chroma[2 * i]     = img->u[i];
+        chroma[2 * i + 1] = img->v[i];
+        break;
+      default:
+        chroma[2 * i]     = img->v[i];
+        chroma[2 * i + 1] = img->u[i];
+        break;
+    }
+  }
+}
+
+/*
+  Reference crop, nearest resize and BT.601 conversion to RGB888 or RGB565.
+*/
+static void ref_convert(const yuv_planes_t *img, int crop_x, int crop_y, int crop_width, int crop_height,
+                        uint8_t *dst, int dst_width, int dst_height, image_format_t dst_format) {
+  const int c_width = (img->width + 1) / 2;
+  const int x_step  = (crop_width << FP_SHIFT) / dst_width;
+
+  for (int dy = 0; dy < dst_height; ++dy) {
+    const int sy = crop_y + (dy * crop_height) / dst_height;
+
+    for (int dx = 0; dx < dst_width; ++dx) {
+      const int sx = ((crop_x << FP_SHIFT) + dx * x_step) >> FP_SHIFT;
+      const int c  = 298 * (img->y[sy * img->width + sx] - 16) + 128;
+      const int d  = img->u[(sy / 2) * c_width + (sx / 2)] - 128;
+      const int e  = img->v[(sy / 2) * c_width + (sx / 2)] - 128;
+      const int r  = clamp_u8((c + 409 * e) >> 8);
+      const int g  = clamp_u8((c - 100 * d - 208 * e) >> 8);
+      const int b  = clamp_u8((c + 516 * d) >> 8);
+
+      if (dst_format == IMAGE_FORMAT_RGB888) {
+        uint8_t *p = &dst[(dy * dst_width + dx) * 3];
+        p[0] = (uint8_t)r;
+        p[1] = (uint8_t)g;
+        p[2] = (uint8_t)b;
+      } else {
+        const uint16_t px = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+        dst[(dy * dst_width + dx) * 2]     = (uint8_t)(px & 0xFF);
+        dst[(dy * dst_width + dx) * 2 + 1] = (uint8_t)(px >> 8);
+      }
+    }
+  }
+}
+
+/* Crop region and output size */
+typedef struct {
+  int crop_x;
+  int crop_y;
+  int crop_width;
+  int crop_height;
+  int dst_width;
+  int dst_height;
+} yuv_geometry_t;
+
+/* Test image sizes, even and odd */
+static const int sizes[][2] = { { 64, 48 }, { 33, 21 } };
+
+/* Crop regions and output sizes, valid for both test image sizes */
+static const yuv_geometry_t geometries[] = {
+  { 0, 0, 32, 20, 32, 20 },   /* Crop only */
+  { 1, 1, 31, 19, 17, 9 },    /* Odd crop, downscale */
+  { 3, 2, 16, 16, 7, 7 },     /* Odd crop, square downscale */
+  { 2, 1, 10, 12, 23, 29 },   /* Upscale */
+};
+
+static int test_rgb(uint32_t *seed) {
+  static const image_format_t formats[] = { IMAGE_FORMAT_RGB888, IMAGE_FORMAT_RGB565 };
+  char name[128];
+  int checks = 0;
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    const int width  = sizes[s][0];
+    const int height = sizes[s][1];
+    const int c_size = ((width + 1) / 2) * ((height + 1) / 2);
+    yuv_planes_t img = { width, height, test_alloc(width * height), test_alloc(c_size), test_alloc(c_size) };
+    uint8_t *frame    = test_alloc(width * height + 2 * c_size);
+    uint8_t *expected = test_alloc(29 * 29 * 3);
+    uint8_t *actual   = test_alloc(29 * 29 * 3);
+
+    fill_planes(&img, 0, 255, 0, 255, seed);
+
+    for (size_t g = 0; g < sizeof(geometries) / sizeof(geometries[0]); ++g) {
+      const yuv_geometry_t *geo = &geometries[g];
+
+      for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+        const int size = geo->dst_width * geo->dst_height * ((formats[f] == IMAGE_FORMAT_RGB888) ? 3 : 2);
+
+        memset(expected, 0x5A, size);
+        ref_convert(&img, geo->crop_x, geo->crop_y, geo->crop_width, geo->crop_height,
+                    expected, geo->dst_width, geo->dst_height, formats[f]);
+
+        for (yuv_format_t layout = YUV_FORMAT_I420; layout <= YUV_FORMAT_NV21; ++layout) {
+          snprintf(name, sizeof(name), "crop_and_resize_yuv420 %dx%d layout %d crop (%d,%d) %dx%d -> %dx%d format %d",
+                   width, height, layout, geo->crop_x, geo->crop_y, geo->crop_width, geo->crop_height,
+                   geo->dst_width, geo->dst_height, formats[f]);
+
+          pack_frame(&img, layout, frame);
+          memset(actual, 0xA5, size);
+          crop_and_resize_yuv420(frame, width, height, geo->crop_x, geo->crop_y, geo->crop_width, geo->crop_height,
+                                 actual, geo->dst_width, geo->dst_height, layout, formats[f]);
+          test_check_equal(name, expected, actual, size);
+          checks++;
+        }
+      }
+    }
+
+    free(actual);
+    free(expected);
+    free(frame);
+    free(img.v);
+    free(img.u);
+    free(img.y);
+  }
+  return checks;
+}
+
+/*
+  Compare the luma-only output with the luma of the RGB888 output.
+
+  \param[in] tolerance  Largest allowed difference in levels.
+*/
+static int check_gray(const char *name, const uint8_t *rgb, const uint8_t *gray, int pixels, int tolerance) {
+  for (int i = 0; i < pixels; ++i) {
+    const int luma = (rgb[i * 3] * 77 + rgb[i * 3 + 1] * 150 + rgb[i * 3 + 2] * 29) >> 8;
+    const int diff = gray[i] - luma;
+
+    if ((diff < -tolerance) || (diff > tolerance)) {
+      fprintf(stderr, "FAIL %s: pixel %d is %u, RGB luma %d\n", name, i, gray[i], luma);
+      test_failures++;
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static int test_gray(uint32_t *seed) {
+  char name[128];
+  int checks = 0;
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    const int width  = sizes[s][0];
+    const int height = sizes[s][1];
+    const int c_size = ((width + 1) / 2) * ((height + 1) / 2);
+    yuv_planes_t img = { width, height, test_alloc(width * height), test_alloc(c_size), test_alloc(c_size) };
+    uint8_t *frame = test_alloc(width * height + 2 * c_size);
+    uint8_t *rgb   = test_alloc(29 * 29 * 3);
+    uint8_t *gray  = test_alloc(29 * 29);
+
+    /* Neutral chroma over the full luma range, then chroma that does not clip */
+    for (int neutral = 1; neutral >= 0; --neutral) {
+      if (neutral) {
+        fill_planes(&img, 0, 255, 128, 128, seed);
+      } else {
+        fill_planes(&img, 64, 192, 112, 144, seed);
+      }
+
+      for (size_t g = 0; g < sizeof(geometries) / sizeof(geometries[0]); ++g) {
+        const yuv_geometry_t *geo = &geometries[g];
+        const int pixels = geo->dst_width * geo->dst_height;
+
+        for (yuv_format_t layout = YUV_FORMAT_I420; layout <= YUV_FORMAT_NV21; ++layout) {
+          snprintf(name, sizeof(name), "crop_and_resize_yuv420 gray %dx%d layout %d crop (%d,%d) %dx%d -> %dx%d %s",
+                   width, height, layout, geo->crop_x, geo->crop_y, geo->crop_width, geo->crop_height,
+                   geo->dst_width, geo->dst_height, neutral ? "neutral" : "colour");
+
+          pack_frame(&img, layout, frame);
+          crop_and_resize_yuv420(frame, width, height, geo->crop_x, geo->crop_y, geo->crop_width, geo->crop_height,
+                                 rgb, geo->dst_width, geo->dst_height, layout, IMAGE_FORMAT_RGB888);
+          memset(gray, 0xA5, pixels);
+          crop_and_resize_yuv420(frame, width, height, geo->crop_x, geo->crop_y, geo->crop_width, geo->crop_height,
+                                 gray, geo->dst_width, geo->dst_height, layout, IMAGE_FORMAT_GRAYSCALE);
+          check_gray(name, rgb, gray, pixels, neutral ? 0 : 1);
+          checks++;
+        }
+      }
+    }
+
+    free(gray);
+    free(rgb);
+    free(frame);
+    free(img.v);
+    free(img.u);
+    free(img.y);
+  }
+  return checks;
+}
+
+int main(void) {
+  uint32_t seed = 0x600DF00DU;
+  int checks = 0;
+
+  checks += test_rgb(&seed);
+  checks += test_gray(&seed);
+
+  return test_report("yuv420", checks);
+}